@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+
+# Analyzes memory allocation traces written by DXVK when
+# the DXVK_MEMORY_TRACE_PATH environment variable is set.
+#
+# Usage: dxvk-memory-trace.py [--top N] [--samples N] file.dxmt
+
+import argparse
+import struct
+import sys
+
+HEADER     = struct.Struct('<4sIIIQ')
+HEAP       = struct.Struct('<QII')
+TYPE       = struct.Struct('<II')
+RECORD     = struct.Struct('<QQQQQIIBBBBI')
+
+OP_DEVICE_ALLOC = 0
+OP_DEVICE_FREE  = 1
+OP_ALLOC        = 2
+OP_FREE         = 3
+
+TAG_NAMES = [ 'unknown', 'buffer', 'image', 'staging', 'sparse page', 'sparse meta' ]
+
+MEMORY_PROPERTY_NAMES = [
+  (0x1, 'device-local'),
+  (0x2, 'host-visible'),
+  (0x4, 'host-coherent'),
+  (0x8, 'host-cached'),
+]
+
+
+def mib(size):
+  return '{:10.2f} MiB'.format(size / float(1 << 20))
+
+
+def tag_name(tag):
+  return TAG_NAMES[tag] if tag < len(TAG_NAMES) else 'tag {}'.format(tag)
+
+
+def type_name(flags):
+  names = [ name for bit, name in MEMORY_PROPERTY_NAMES if flags & bit ]
+  return ', '.join(names) if names else 'none'
+
+
+class Allocation:
+  def __init__(self, record):
+    (self.time, self.memory, self.offset, self.size, self.object,
+     self.usage, self.format, _, self.tag, self.mem_type, self.hints, _) = record
+
+
+class DeviceMemory:
+  def __init__(self, mem_type, size, time):
+    self.mem_type = mem_type
+    self.size     = size
+    self.time     = time
+    self.allocs   = { }
+
+  def used(self):
+    return sum(a.size for a in self.allocs.values())
+
+  def largest_hole(self):
+    largest = 0
+    offset  = 0
+
+    for a in sorted(self.allocs.values(), key = lambda a: a.offset):
+      largest = max(largest, a.offset - offset)
+      offset  = max(offset, a.offset + a.size)
+
+    return max(largest, self.size - offset)
+
+
+class Trace:
+  def __init__(self, data):
+    magic, version, heap_count, type_count, self.max_chunk_size = HEADER.unpack_from(data, 0)
+
+    if magic != b'DXMT' or version != 1:
+      raise ValueError('Not a DXVK memory trace, or unsupported version')
+
+    offset = HEADER.size
+    self.heaps = [ ]
+    self.types = [ ]
+
+    for i in range(heap_count):
+      size, flags, _ = HEAP.unpack_from(data, offset)
+      self.heaps.append((size, flags))
+      offset += HEAP.size
+
+    for i in range(type_count):
+      self.types.append(TYPE.unpack_from(data, offset))
+      offset += TYPE.size
+
+    count = (len(data) - offset) // RECORD.size
+    self.records = [ RECORD.unpack_from(data, offset + i * RECORD.size) for i in range(count) ]
+
+    if (len(data) - offset) % RECORD.size:
+      print('Warning: Trace is truncated', file = sys.stderr)
+
+
+class Replay:
+  def __init__(self, trace, samples):
+    self.trace      = trace
+    self.memory     = { }
+    self.allocated  = [ 0 ] * len(trace.heaps)
+    self.used       = [ 0 ] * len(trace.heaps)
+    self.peak_alloc = [ 0 ] * len(trace.heaps)
+    self.peak_used  = [ 0 ] * len(trace.heaps)
+    self.timeline   = [ ]
+    self.chunk_sizes = { }
+    self.alloc_sizes = { }
+    self.errors     = 0
+
+    end_time = trace.records[-1][0] if trace.records else 0
+    interval = max(end_time // max(samples, 1), 1)
+    next_sample = 0
+
+    for record in trace.records:
+      time, handle, offset, size, _, _, _, op, _, mem_type, _, _ = record
+      heap = trace.types[mem_type][0]
+
+      if op == OP_DEVICE_ALLOC:
+        self.memory[handle] = DeviceMemory(mem_type, size, time)
+        self.allocated[heap] += size
+        self.peak_alloc[heap] = max(self.peak_alloc[heap], self.allocated[heap])
+      elif op == OP_DEVICE_FREE:
+        if self.memory.pop(handle, None) is None:
+          self.errors += 1
+        self.allocated[heap] -= size
+      elif op == OP_ALLOC:
+        alloc = Allocation(record)
+        mem = self.memory.get(handle)
+
+        if mem is None:
+          self.errors += 1
+          continue
+
+        mem.allocs[offset] = alloc
+        self.used[heap] += size
+        self.peak_used[heap] = max(self.peak_used[heap], self.used[heap])
+
+        dedicated = offset == 0 and size == mem.size and mem.time == time
+        key = (alloc.tag, dedicated)
+        self.alloc_sizes.setdefault(key, [ ]).append(size)
+      elif op == OP_FREE:
+        mem = self.memory.get(handle)
+
+        if mem is None or mem.allocs.pop(offset, None) is None:
+          self.errors += 1
+          continue
+
+        self.used[heap] -= size
+
+      while time >= next_sample:
+        self.timeline.append((next_sample, list(self.allocated), list(self.used)))
+        next_sample += interval
+
+    self.timeline.append((end_time, list(self.allocated), list(self.used)))
+
+
+def print_heaps(trace, replay):
+  print('Memory heaps:')
+
+  for i, (size, flags) in enumerate(trace.heaps):
+    print('  Heap {}: {} ({})'.format(i, mib(size), 'device-local' if flags & 1 else 'system'))
+    print('    Peak allocated: {}'.format(mib(replay.peak_alloc[i])))
+    print('    Peak used:      {}'.format(mib(replay.peak_used[i])))
+
+  print('  Max chunk size: {}'.format(mib(trace.max_chunk_size)))
+  print()
+
+
+def print_timeline(trace, replay):
+  print('Usage over time (allocated / used per heap):')
+
+  for time, allocated, used in replay.timeline:
+    heaps = '  '.join('{} / {}'.format(mib(a).strip(), mib(u).strip())
+      for a, u in zip(allocated, used))
+    print('  {:10.3f}s  {}'.format(time / 1e6, heaps))
+
+  print()
+
+
+def print_fragmentation(trace, replay):
+  print('Fragmentation at end of trace:')
+
+  per_type = { }
+
+  for mem in replay.memory.values():
+    per_type.setdefault(mem.mem_type, [ ]).append(mem)
+
+  for mem_type, chunks in sorted(per_type.items()):
+    size  = sum(c.size for c in chunks)
+    used  = sum(c.used() for c in chunks)
+    free  = size - used
+    holes = [ c.largest_hole() for c in chunks ]
+    empty = sum(1 for c in chunks if not c.allocs)
+
+    frag = 1.0 - (max(holes) / float(free)) if free else 0.0
+
+    print('  Type {} ({}):'.format(mem_type, type_name(trace.types[mem_type][1])))
+    print('    Memory objects: {} ({} empty)'.format(len(chunks), empty))
+    print('    Allocated:      {}'.format(mib(size)))
+    print('    Used:           {}'.format(mib(used)))
+    print('    Largest hole:   {}'.format(mib(max(holes))))
+    print('    Fragmentation:  {:9.1f} %'.format(frag * 100.0))
+
+  print()
+
+
+def print_sizes(trace, replay):
+  print('Allocation sizes:')
+
+  for (tag, dedicated), sizes in sorted(replay.alloc_sizes.items()):
+    sizes.sort()
+    print('  {:12} {:10} count {:8}  median {}  max {}'.format(
+      tag_name(tag), 'dedicated' if dedicated else 'suballoc', len(sizes),
+      mib(sizes[len(sizes) // 2]), mib(sizes[-1])))
+
+    if not dedicated:
+      large = sum(1 for s in sizes if 3 * s >= trace.max_chunk_size)
+      if large:
+        print('    {} allocations would prefer a dedicated allocation at the current chunk size'.format(large))
+
+  print()
+
+
+def print_consumers(trace, replay, top):
+  live = { }
+
+  for mem in replay.memory.values():
+    for a in mem.allocs.values():
+      entry = live.setdefault(a.object, [ a.tag, a.usage, a.format, 0, 0, a.time ])
+      entry[3] += a.size
+      entry[4] += 1
+      entry[5] = min(entry[5], a.time)
+
+  print('Top consumers still alive at end of trace:')
+  print('  {:>18}  {:12} {:>10} {:>8} {:>14} {:>12}'.format(
+    'object', 'type', 'usage', 'format', 'size', 'since'))
+
+  for obj, (tag, usage, fmt, size, count, since) in sorted(live.items(), key = lambda e: -e[1][3])[:top]:
+    print('  {:#18x}  {:12} {:#10x} {:8} {} {:11.3f}s{}'.format(obj, tag_name(tag), usage, fmt,
+      mib(size), since / 1e6, ' ({} slices)'.format(count) if count > 1 else ''))
+
+  per_tag = { }
+
+  for tag, _, _, size, _, _ in live.values():
+    per_tag[tag] = per_tag.get(tag, 0) + size
+
+  print()
+  print('Live memory by resource type:')
+
+  for tag, size in sorted(per_tag.items(), key = lambda e: -e[1]):
+    print('  {:12} {}'.format(tag_name(tag), mib(size)))
+
+  print()
+
+
+def main():
+  parser = argparse.ArgumentParser(description = 'Analyze DXVK memory allocation traces')
+  parser.add_argument('file', help = 'Trace file')
+  parser.add_argument('--top', type = int, default = 20, help = 'Number of top consumers to list')
+  parser.add_argument('--samples', type = int, default = 20, help = 'Number of timeline samples')
+  args = parser.parse_args()
+
+  with open(args.file, 'rb') as f:
+    trace = Trace(f.read())
+
+  replay = Replay(trace, args.samples)
+
+  print_heaps(trace, replay)
+  print_timeline(trace, replay)
+  print_fragmentation(trace, replay)
+  print_sizes(trace, replay)
+  print_consumers(trace, replay, args.top)
+
+  if replay.errors:
+    print('Warning: {} records did not match any allocation'.format(replay.errors), file = sys.stderr)
+
+
+if __name__ == '__main__':
+  main()
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <array>
+
 #include "d3d11_include.h"
 
+#include "../dxvk/dxvk_include.h"
+
 namespace dxvk {
 
   /**
@@ -13,6 +17,7 @@ namespace dxvk {
   enum class D3D11CmdType {
     DrawIndirect,
     DrawIndirectIndexed,
+    UpdateImage,
   };
 
 
@@ -40,4 +45,24 @@ namespace dxvk {
     uint32_t            stride;
   };
 
+
+  /**
+   * \brief Image update command data
+   *
+   * Stores copy regions for consecutive image updates
+   * that read from the same staging buffer and write to
+   * the same image, so that they can be executed with a
+   * single copy command. The image and buffer pointers
+   * are only used to check whether an update can be
+   * merged, the command itself keeps both objects alive.
+   */
+  struct D3D11CmdUpdateImageData : public D3D11CmdData {
+    constexpr static uint32_t MaxRegions = 8;
+
+    const void*         image;
+    const void*         buffer;
+    uint32_t            regionCount;
+    std::array<VkBufferImageCopy, MaxRegions> regions;
+  };
+
 }
\ No newline at end of file
@@ -16,6 +16,7 @@ namespace dxvk {
     m_contextExt(GetTypedContext()),
     m_annotation(GetTypedContext(), Device),
     m_device    (Device),
+    m_stateVersion(0u),
     m_flags     (ContextFlags),
     m_staging   (Device, StagingBufferSize),
     m_csFlags   (CsFlags),
@@ -978,6 +979,7 @@ namespace dxvk {
   template<typename ContextType>
   void STDMETHODCALLTYPE D3D11CommonContext<ContextType>::DrawAuto() {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyGraphicsBindings();
 
     D3D11Buffer* buffer = m_state.ia.vertexBuffers[0].buffer.ptr();
 
@@ -1003,6 +1005,7 @@ namespace dxvk {
           UINT            VertexCount,
           UINT            StartVertexLocation) {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyGraphicsBindings();
 
     EmitCs([=] (DxvkContext* ctx) {
       ctx->draw(
@@ -1018,6 +1021,7 @@ namespace dxvk {
           UINT            StartIndexLocation,
           INT             BaseVertexLocation) {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyGraphicsBindings();
 
     EmitCs([=] (DxvkContext* ctx) {
       ctx->drawIndexed(
@@ -1035,6 +1039,7 @@ namespace dxvk {
           UINT            StartVertexLocation,
           UINT            StartInstanceLocation) {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyGraphicsBindings();
 
     EmitCs([=] (DxvkContext* ctx) {
       ctx->draw(
@@ -1054,6 +1059,7 @@ namespace dxvk {
           INT             BaseVertexLocation,
           UINT            StartInstanceLocation) {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyGraphicsBindings();
 
     EmitCs([=] (DxvkContext* ctx) {
       ctx->drawIndexed(
@@ -1076,6 +1082,8 @@ namespace dxvk {
     if (!ValidateDrawBufferSize(pBufferForArgs, AlignedByteOffsetForArgs, sizeof(VkDrawIndexedIndirectCommand)))
       return;
 
+    ApplyDirtyGraphicsBindings();
+
     // If possible, batch up multiple indirect draw calls of
     // the same type into one single multiDrawIndirect call
     auto cmdData = static_cast<D3D11CmdDrawIndirectData*>(m_cmdData);
@@ -1111,6 +1119,8 @@ namespace dxvk {
     if (!ValidateDrawBufferSize(pBufferForArgs, AlignedByteOffsetForArgs, sizeof(VkDrawIndirectCommand)))
       return;
 
+    ApplyDirtyGraphicsBindings();
+
     // If possible, batch up multiple indirect draw calls of
     // the same type into one single multiDrawIndirect call
     auto cmdData = static_cast<D3D11CmdDrawIndirectData*>(m_cmdData);
@@ -1142,6 +1152,7 @@ namespace dxvk {
           UINT            ThreadGroupCountY,
           UINT            ThreadGroupCountZ) {
     D3D10DeviceLock lock = LockContext();
+    ApplyDirtyComputeBindings();
 
     EmitCs([=] (DxvkContext* ctx) {
       ctx->dispatch(
@@ -1162,6 +1173,8 @@ namespace dxvk {
     if (!ValidateDrawBufferSize(pBufferForArgs, AlignedByteOffsetForArgs, sizeof(VkDispatchIndirectCommand)))
       return;
 
+    ApplyDirtyComputeBindings();
+
     EmitCs([cOffset = AlignedByteOffsetForArgs]
     (DxvkContext* ctx) {
       ctx->dispatchIndirect(cOffset);
@@ -1185,6 +1198,7 @@ namespace dxvk {
         equal = m_state.ia.inputLayout->Compare(inputLayout);
 
       m_state.ia.inputLayout = inputLayout;
+      UpdateStateVersion(m_state.version.ia);
 
       if (!equal)
         ApplyInputLayout();
@@ -1198,6 +1212,7 @@ namespace dxvk {
 
     if (m_state.ia.primitiveTopology != Topology) {
       m_state.ia.primitiveTopology = Topology;
+      UpdateStateVersion(m_state.version.ia);
       ApplyPrimitiveTopology();
     }
   }
@@ -1219,12 +1234,14 @@ namespace dxvk {
         m_state.ia.vertexBuffers[StartSlot + i].buffer = newBuffer;
         m_state.ia.vertexBuffers[StartSlot + i].offset = pOffsets[i];
         m_state.ia.vertexBuffers[StartSlot + i].stride = pStrides[i];
+        UpdateStateVersion(m_state.version.ia);
 
         BindVertexBuffer(StartSlot + i, newBuffer, pOffsets[i], pStrides[i]);
       } else if (m_state.ia.vertexBuffers[StartSlot + i].offset != pOffsets[i]
               || m_state.ia.vertexBuffers[StartSlot + i].stride != pStrides[i]) {
         m_state.ia.vertexBuffers[StartSlot + i].offset = pOffsets[i];
         m_state.ia.vertexBuffers[StartSlot + i].stride = pStrides[i];
+        UpdateStateVersion(m_state.version.ia);
 
         BindVertexBufferRange(StartSlot + i, newBuffer, pOffsets[i], pStrides[i]);
       }
@@ -1248,12 +1265,14 @@ namespace dxvk {
       m_state.ia.indexBuffer.buffer = newBuffer;
       m_state.ia.indexBuffer.offset = Offset;
       m_state.ia.indexBuffer.format = Format;
+      UpdateStateVersion(m_state.version.ia);
 
       BindIndexBuffer(newBuffer, Offset, Format);
     } else if (m_state.ia.indexBuffer.offset != Offset
             || m_state.ia.indexBuffer.format != Format) {
       m_state.ia.indexBuffer.offset = Offset;
       m_state.ia.indexBuffer.format = Format;
+      UpdateStateVersion(m_state.version.ia);
 
       BindIndexBufferRange(newBuffer, Offset, Format);
     }
@@ -1341,6 +1360,7 @@ namespace dxvk {
 
     if (m_state.vs != shader) {
       m_state.vs = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::VertexShader)]);
 
       BindShader<DxbcProgramType::VertexShader>(GetCommonShader(shader));
     }
@@ -1479,6 +1499,7 @@ namespace dxvk {
 
     if (m_state.hs != shader) {
       m_state.hs = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::HullShader)]);
 
       BindShader<DxbcProgramType::HullShader>(GetCommonShader(shader));
     }
@@ -1617,6 +1638,7 @@ namespace dxvk {
 
     if (m_state.ds != shader) {
       m_state.ds = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::DomainShader)]);
 
       BindShader<DxbcProgramType::DomainShader>(GetCommonShader(shader));
     }
@@ -1755,6 +1777,7 @@ namespace dxvk {
 
     if (m_state.gs != shader) {
       m_state.gs = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::GeometryShader)]);
 
       BindShader<DxbcProgramType::GeometryShader>(GetCommonShader(shader));
     }
@@ -1893,6 +1916,7 @@ namespace dxvk {
 
     if (m_state.ps != shader) {
       m_state.ps = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::PixelShader)]);
 
       BindShader<DxbcProgramType::PixelShader>(GetCommonShader(shader));
     }
@@ -2031,6 +2055,7 @@ namespace dxvk {
 
     if (m_state.cs != shader) {
       m_state.cs = shader;
+      UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::ComputeShader)]);
 
       BindShader<DxbcProgramType::ComputeShader>(GetCommonShader(shader));
     }
@@ -2114,6 +2139,8 @@ namespace dxvk {
             m_state.uav.views[uavId] = nullptr;
             m_state.uav.mask.clr(uavId);
 
+            UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::ComputeShader)]);
+
             BindUnorderedAccessView<DxbcProgramType::ComputeShader>(
               uavSlotId + uavId, nullptr,
               ctrSlotId + uavId, ~0u);
@@ -2135,6 +2162,8 @@ namespace dxvk {
         m_state.uav.views[StartSlot + i] = uav;
         m_state.uav.mask.set(StartSlot + i, uav != nullptr);
 
+        UpdateStateVersion(m_state.version.stages[uint32_t(DxbcProgramType::ComputeShader)]);
+
         BindUnorderedAccessView<DxbcProgramType::ComputeShader>(
           uavSlotId + StartSlot + i, uav,
           ctrSlotId + StartSlot + i, ctr);
@@ -2273,6 +2302,7 @@ namespace dxvk {
      || m_state.om.sampleMask != SampleMask) {
       m_state.om.cbState    = blendState;
       m_state.om.sampleMask = SampleMask;
+      UpdateStateVersion(m_state.version.om);
 
       ApplyBlendState();
     }
@@ -2281,6 +2311,7 @@ namespace dxvk {
       for (uint32_t i = 0; i < 4; i++)
         m_state.om.blendFactor[i] = BlendFactor[i];
 
+      UpdateStateVersion(m_state.version.om);
       ApplyBlendFactor();
     }
   }
@@ -2296,6 +2327,7 @@ namespace dxvk {
 
     if (m_state.om.dsState != depthStencilState) {
       m_state.om.dsState = depthStencilState;
+      UpdateStateVersion(m_state.version.om);
       ApplyDepthStencilState();
     }
 
@@ -2305,6 +2337,7 @@ namespace dxvk {
 
     if (m_state.om.stencilRef != StencilRef) {
       m_state.om.stencilRef = StencilRef;
+      UpdateStateVersion(m_state.version.om);
       ApplyStencilRef();
     }
   }
@@ -2393,6 +2426,7 @@ namespace dxvk {
 
     if (m_state.rs.state != nextRasterizerState) {
       m_state.rs.state = nextRasterizerState;
+      UpdateStateVersion(m_state.version.rs);
       ApplyRasterizerState();
 
       // If necessary, update the rasterizer sample count push constant
@@ -2438,8 +2472,10 @@ namespace dxvk {
       m_state.rs.viewports[i] = pViewports[i];
     }
 
-    if (dirty)
+    if (dirty) {
+      UpdateStateVersion(m_state.version.rs);
       ApplyViewportState();
+    }
   }
 
 
@@ -2469,6 +2505,9 @@ namespace dxvk {
       }
     }
 
+    if (dirty)
+      UpdateStateVersion(m_state.version.rs);
+
     if (m_state.rs.state != nullptr && dirty) {
       D3D11_RASTERIZER_DESC rsDesc;
       m_state.rs.state->GetDesc(&rsDesc);
@@ -2562,6 +2601,8 @@ namespace dxvk {
       m_state.so.targets[i].offset = 0;
     }
 
+    UpdateStateVersion(m_state.version.so);
+
     for (uint32_t i = 0; i < D3D11_SO_BUFFER_SLOT_COUNT; i++) {
       BindXfbBuffer(i,
         m_state.so.targets[i].buffer.ptr(),
@@ -3390,6 +3431,78 @@ namespace dxvk {
   }
 
 
+  template<typename ContextType>
+  void D3D11CommonContext<ContextType>::ApplyDirtyGraphicsBindings() {
+    constexpr uint32_t GraphicsStages =
+      (1u << uint32_t(DxbcProgramType::VertexShader))   |
+      (1u << uint32_t(DxbcProgramType::HullShader))     |
+      (1u << uint32_t(DxbcProgramType::DomainShader))   |
+      (1u << uint32_t(DxbcProgramType::GeometryShader)) |
+      (1u << uint32_t(DxbcProgramType::PixelShader));
+
+    if (likely(!(m_state.dirty.stageMask & GraphicsStages)))
+      return;
+
+    ApplyDirtyBindings<DxbcProgramType::VertexShader>();
+    ApplyDirtyBindings<DxbcProgramType::HullShader>();
+    ApplyDirtyBindings<DxbcProgramType::DomainShader>();
+    ApplyDirtyBindings<DxbcProgramType::GeometryShader>();
+    ApplyDirtyBindings<DxbcProgramType::PixelShader>();
+  }
+
+
+  template<typename ContextType>
+  void D3D11CommonContext<ContextType>::ApplyDirtyComputeBindings() {
+    ApplyDirtyBindings<DxbcProgramType::ComputeShader>();
+  }
+
+
+  template<typename ContextType>
+  template<DxbcProgramType ShaderStage>
+  void D3D11CommonContext<ContextType>::ApplyDirtyBindings() {
+    uint32_t stageBit = 1u << uint32_t(ShaderStage);
+
+    if (!(m_state.dirty.stageMask & stageBit))
+      return;
+
+    auto& dirty = m_state.dirty.stages[ShaderStage];
+
+    // Constant buffers where only the bound range changed
+    // can use the cheaper range update on the DXVK side
+    const auto& cbvBindings = m_state.cbv[ShaderStage];
+    uint32_t cbvSlotId = computeConstantBufferBinding(ShaderStage, 0);
+
+    for (uint32_t i : bit::BitMask(dirty.cbvMask)) {
+      const auto& cbv = cbvBindings.buffers[i];
+      BindConstantBuffer<ShaderStage>(cbvSlotId + i, cbv.buffer.ptr(), cbv.constantOffset, cbv.constantBound);
+    }
+
+    for (uint32_t i : bit::BitMask(dirty.cbvRangeMask & ~dirty.cbvMask)) {
+      const auto& cbv = cbvBindings.buffers[i];
+      BindConstantBufferRange<ShaderStage>(cbvSlotId + i, cbv.constantOffset, cbv.constantBound);
+    }
+
+    const auto& srvBindings = m_state.srv[ShaderStage];
+    uint32_t srvSlotId = computeSrvBinding(ShaderStage, 0);
+    int32_t srvId = dirty.srvMask.findNext(0);
+
+    while (srvId >= 0) {
+      BindShaderResource<ShaderStage>(srvSlotId + srvId, srvBindings.views[srvId].ptr());
+      srvId = dirty.srvMask.findNext(srvId + 1);
+    }
+
+    const auto& samplerBindings = m_state.samplers[ShaderStage];
+    uint32_t samplerSlotId = computeSamplerBinding(ShaderStage, 0);
+
+    for (uint32_t i : bit::BitMask(dirty.samplerMask))
+      BindSampler<ShaderStage>(samplerSlotId + i, samplerBindings.samplers[i]);
+
+    dirty.reset();
+
+    m_state.dirty.stageMask &= ~stageBit;
+  }
+
+
   template<typename ContextType>
   template<DxbcProgramType ShaderStage>
   void D3D11CommonContext<ContextType>::BindShader(
@@ -4513,6 +4626,11 @@ namespace dxvk {
     m_state.srv.reset();
     m_state.uav.reset();
     m_state.samplers.reset();
+
+    m_state.dirty.reset();
+
+    // Default state always uses version zero
+    m_state.version = D3D11ContextStateVersion();
   }
 
 
@@ -4541,6 +4659,11 @@ namespace dxvk {
           bindings.views[srvId] = nullptr;
           bindings.hazardous.clr(srvId);
 
+          // Unbind immediately rather than deferring it to the
+          // next draw, any pending binding is now redundant
+          m_state.dirty.stages[ShaderStage].srvMask.clr(srvId);
+          UpdateStateVersion(m_state.version.stages[uint32_t(ShaderStage)]);
+
           BindShaderResource<ShaderStage>(slotId + srvId, nullptr);
         }
       } else {
@@ -4611,6 +4734,7 @@ namespace dxvk {
     for (uint32_t i = 0; i < m_state.om.maxUav; i++) {
       if (CheckViewOverlap(pView, m_state.om.uavs[i].ptr())) {
         m_state.om.uavs[i] = nullptr;
+        UpdateStateVersion(m_state.version.om);
 
         BindUnorderedAccessView<DxbcProgramType::PixelShader>(
           uavSlotId + i, nullptr,
@@ -4683,16 +4807,123 @@ namespace dxvk {
     RestoreSamplers<DxbcProgramType::GeometryShader>();
     RestoreSamplers<DxbcProgramType::PixelShader>();
     RestoreSamplers<DxbcProgramType::ComputeShader>();
+
+    // Everything is bound now, nothing left to apply
+    m_state.dirty.reset();
+  }
+
+  template<typename ContextType>
+  void D3D11CommonContext<ContextType>::RestoreChangedState(
+    const D3D11ContextStateVersion&         PrevVersion,
+    const D3D11MaxUsedBindings&             PrevBindings) {
+    // Only rebind state groups whose version differs from the
+    // previously active state, since identical versions imply
+    // identical state. Binding counts must cover both states
+    // so that stale bindings of the previous state get unbound.
+    const auto& version = m_state.version;
+
+    if (version.om != PrevVersion.om) {
+      BindFramebuffer();
+
+      ApplyBlendState();
+      ApplyBlendFactor();
+      ApplyDepthStencilState();
+      ApplyStencilRef();
+
+      RestoreUnorderedAccessViews<DxbcProgramType::PixelShader>(
+        PrevBindings.stages[uint32_t(DxbcProgramType::PixelShader)].uavCount);
+    }
+
+    if (version.rs != PrevVersion.rs) {
+      ApplyRasterizerState();
+      ApplyViewportState();
+    }
+
+    if (version.om != PrevVersion.om || version.rs != PrevVersion.rs)
+      ApplyRasterizerSampleCount();
+
+    if (version.ia != PrevVersion.ia) {
+      ApplyInputLayout();
+      ApplyPrimitiveTopology();
+
+      BindDrawBuffers(
+        m_state.id.argBuffer.ptr(),
+        m_state.id.cntBuffer.ptr());
+
+      BindIndexBuffer(
+        m_state.ia.indexBuffer.buffer.ptr(),
+        m_state.ia.indexBuffer.offset,
+        m_state.ia.indexBuffer.format);
+
+      uint32_t vbCount = std::max(m_state.ia.maxVbCount, PrevBindings.vbCount);
+
+      for (uint32_t i = 0; i < vbCount; i++) {
+        BindVertexBuffer(i,
+          m_state.ia.vertexBuffers[i].buffer.ptr(),
+          m_state.ia.vertexBuffers[i].offset,
+          m_state.ia.vertexBuffers[i].stride);
+      }
+    }
+
+    if (version.so != PrevVersion.so) {
+      for (uint32_t i = 0; i < m_state.so.targets.size(); i++)
+        BindXfbBuffer(i, m_state.so.targets[i].buffer.ptr(), ~0u);
+    }
+
+    RestoreChangedStage<DxbcProgramType::VertexShader>(PrevVersion, PrevBindings);
+    RestoreChangedStage<DxbcProgramType::HullShader>(PrevVersion, PrevBindings);
+    RestoreChangedStage<DxbcProgramType::DomainShader>(PrevVersion, PrevBindings);
+    RestoreChangedStage<DxbcProgramType::GeometryShader>(PrevVersion, PrevBindings);
+    RestoreChangedStage<DxbcProgramType::PixelShader>(PrevVersion, PrevBindings);
+    RestoreChangedStage<DxbcProgramType::ComputeShader>(PrevVersion, PrevBindings);
+  }
+
+
+  template<typename ContextType>
+  template<DxbcProgramType Stage>
+  void D3D11CommonContext<ContextType>::RestoreChangedStage(
+    const D3D11ContextStateVersion&         PrevVersion,
+    const D3D11MaxUsedBindings&             PrevBindings) {
+    uint32_t stageIndex = uint32_t(Stage);
+
+    if (m_state.version.stages[stageIndex] == PrevVersion.stages[stageIndex])
+      return;
+
+    const auto& prevCounts = PrevBindings.stages[stageIndex];
+
+    switch (Stage) {
+      case DxbcProgramType::VertexShader:   BindShader<Stage>(GetCommonShader(m_state.vs.ptr())); break;
+      case DxbcProgramType::HullShader:     BindShader<Stage>(GetCommonShader(m_state.hs.ptr())); break;
+      case DxbcProgramType::DomainShader:   BindShader<Stage>(GetCommonShader(m_state.ds.ptr())); break;
+      case DxbcProgramType::GeometryShader: BindShader<Stage>(GetCommonShader(m_state.gs.ptr())); break;
+      case DxbcProgramType::PixelShader:    BindShader<Stage>(GetCommonShader(m_state.ps.ptr())); break;
+      case DxbcProgramType::ComputeShader:  BindShader<Stage>(GetCommonShader(m_state.cs.ptr())); break;
+      default: break;
+    }
+
+    RestoreConstantBuffers<Stage>(prevCounts.cbvCount);
+    RestoreShaderResources<Stage>(prevCounts.srvCount);
+    RestoreSamplers<Stage>(prevCounts.samplerCount);
+
+    if (Stage == DxbcProgramType::ComputeShader)
+      RestoreUnorderedAccessViews<Stage>(prevCounts.uavCount);
+
+    // All bindings of this stage are now up to date
+    m_state.dirty.stages[Stage].reset();
+    m_state.dirty.stageMask &= ~(1u << stageIndex);
   }
 
 
+
   template<typename ContextType>
   template<DxbcProgramType Stage>
-  void D3D11CommonContext<ContextType>::RestoreConstantBuffers() {
+  void D3D11CommonContext<ContextType>::RestoreConstantBuffers(
+          uint32_t                          MinCount) {
     const auto& bindings = m_state.cbv[Stage];
     uint32_t slotId = computeConstantBufferBinding(Stage, 0);
+    uint32_t count = std::max(bindings.maxCount, MinCount);
 
-    for (uint32_t i = 0; i < bindings.maxCount; i++) {
+    for (uint32_t i = 0; i < count; i++) {
       BindConstantBuffer<Stage>(slotId + i, bindings.buffers[i].buffer.ptr(),
         bindings.buffers[i].constantOffset, bindings.buffers[i].constantBound);
     }
@@ -4701,29 +4932,34 @@ namespace dxvk {
 
   template<typename ContextType>
   template<DxbcProgramType Stage>
-  void D3D11CommonContext<ContextType>::RestoreSamplers() {
+  void D3D11CommonContext<ContextType>::RestoreSamplers(
+          uint32_t                          MinCount) {
     const auto& bindings = m_state.samplers[Stage];
     uint32_t slotId = computeSamplerBinding(Stage, 0);
+    uint32_t count = std::max(bindings.maxCount, MinCount);
 
-    for (uint32_t i = 0; i < bindings.maxCount; i++)
+    for (uint32_t i = 0; i < count; i++)
       BindSampler<Stage>(slotId + i, bindings.samplers[i]);
   }
 
 
   template<typename ContextType>
   template<DxbcProgramType Stage>
-  void D3D11CommonContext<ContextType>::RestoreShaderResources() {
+  void D3D11CommonContext<ContextType>::RestoreShaderResources(
+          uint32_t                          MinCount) {
     const auto& bindings = m_state.srv[Stage];
     uint32_t slotId = computeSrvBinding(Stage, 0);
+    uint32_t count = std::max(bindings.maxCount, MinCount);
 
-    for (uint32_t i = 0; i < bindings.maxCount; i++)
+    for (uint32_t i = 0; i < count; i++)
       BindShaderResource<Stage>(slotId + i, bindings.views[i].ptr());
   }
 
 
   template<typename ContextType>
   template<DxbcProgramType Stage>
-  void D3D11CommonContext<ContextType>::RestoreUnorderedAccessViews() {
+  void D3D11CommonContext<ContextType>::RestoreUnorderedAccessViews(
+          uint32_t                          MinCount) {
     const auto& views = Stage == DxbcProgramType::ComputeShader
       ? m_state.uav.views
       : m_state.om.uavs;
@@ -4732,6 +4968,8 @@ namespace dxvk {
       ? m_state.uav.maxCount
       : m_state.om.maxUav;
 
+    maxCount = std::max(maxCount, MinCount);
+
     uint32_t uavSlotId = computeUavBinding(Stage, 0);
     uint32_t ctrSlotId = computeUavCounterBinding(Stage, 0);
 
@@ -4750,7 +4988,9 @@ namespace dxvk {
           UINT                              NumBuffers,
           ID3D11Buffer* const*              ppConstantBuffers) {
     auto& bindings = m_state.cbv[ShaderStage];
-    uint32_t slotId = computeConstantBufferBinding(ShaderStage, StartSlot);
+    auto& dirty = m_state.dirty.stages[ShaderStage];
+
+    bool changed = false;
 
     for (uint32_t i = 0; i < NumBuffers; i++) {
       auto newBuffer = static_cast<D3D11Buffer*>(ppConstantBuffers[i]);
@@ -4767,12 +5007,18 @@ namespace dxvk {
         bindings.buffers[StartSlot + i].constantCount  = constantCount;
         bindings.buffers[StartSlot + i].constantBound  = constantCount;
 
-        BindConstantBuffer<ShaderStage>(slotId + i, newBuffer, 0, constantCount);
+        dirty.cbvMask |= 1u << (StartSlot + i);
+        changed = true;
       }
     }
 
     bindings.maxCount = std::clamp(StartSlot + NumBuffers,
       bindings.maxCount, uint32_t(bindings.buffers.size()));
+
+    if (changed) {
+      m_state.dirty.stageMask |= 1u << uint32_t(ShaderStage);
+      UpdateStateVersion(m_state.version.stages[uint32_t(ShaderStage)]);
+    }
   }
 
 
@@ -4785,8 +5031,9 @@ namespace dxvk {
     const UINT*                             pFirstConstant,
     const UINT*                             pNumConstants) {
     auto& bindings = m_state.cbv[ShaderStage];
+    auto& dirty = m_state.dirty.stages[ShaderStage];
 
-    uint32_t slotId = computeConstantBufferBinding(ShaderStage, StartSlot);
+    bool changed = false;
 
     for (uint32_t i = 0; i < NumBuffers; i++) {
       auto newBuffer = static_cast<D3D11Buffer*>(ppConstantBuffers[i]);
@@ -4826,19 +5073,26 @@ namespace dxvk {
         bindings.buffers[StartSlot + i].constantCount  = constantCount;
         bindings.buffers[StartSlot + i].constantBound  = constantBound;
 
-        BindConstantBuffer<ShaderStage>(slotId + i, newBuffer, constantOffset, constantBound);
+        dirty.cbvMask |= 1u << (StartSlot + i);
+        changed = true;
       } else if (bindings.buffers[StartSlot + i].constantOffset != constantOffset
               || bindings.buffers[StartSlot + i].constantCount  != constantCount) {
         bindings.buffers[StartSlot + i].constantOffset = constantOffset;
         bindings.buffers[StartSlot + i].constantCount  = constantCount;
         bindings.buffers[StartSlot + i].constantBound  = constantBound;
 
-        BindConstantBufferRange<ShaderStage>(slotId + i, constantOffset, constantBound);
+        dirty.cbvRangeMask |= 1u << (StartSlot + i);
+        changed = true;
       }
     }
 
     bindings.maxCount = std::clamp(StartSlot + NumBuffers,
       bindings.maxCount, uint32_t(bindings.buffers.size()));
+
+    if (changed) {
+      m_state.dirty.stageMask |= 1u << uint32_t(ShaderStage);
+      UpdateStateVersion(m_state.version.stages[uint32_t(ShaderStage)]);
+    }
   }
 
 
@@ -4849,7 +5103,9 @@ namespace dxvk {
           UINT                              NumResources,
           ID3D11ShaderResourceView* const*  ppResources) {
     auto& bindings = m_state.srv[ShaderStage];
-    uint32_t slotId = computeSrvBinding(ShaderStage, StartSlot);
+    auto& dirty = m_state.dirty.stages[ShaderStage];
+
+    bool changed = false;
 
     for (uint32_t i = 0; i < NumResources; i++) {
       auto resView = static_cast<D3D11ShaderResourceView*>(ppResources[i]);
@@ -4868,12 +5124,18 @@ namespace dxvk {
         }
 
         bindings.views[StartSlot + i] = resView;
-        BindShaderResource<ShaderStage>(slotId + i, resView);
+        dirty.srvMask.set(StartSlot + i);
+        changed = true;
       }
     }
 
     bindings.maxCount = std::clamp(StartSlot + NumResources,
       bindings.maxCount, uint32_t(bindings.views.size()));
+
+    if (changed) {
+      m_state.dirty.stageMask |= 1u << uint32_t(ShaderStage);
+      UpdateStateVersion(m_state.version.stages[uint32_t(ShaderStage)]);
+    }
   }
 
 
@@ -4884,19 +5146,27 @@ namespace dxvk {
           UINT                              NumSamplers,
           ID3D11SamplerState* const*        ppSamplers) {
     auto& bindings = m_state.samplers[ShaderStage];
-    uint32_t slotId = computeSamplerBinding(ShaderStage, StartSlot);
+    auto& dirty = m_state.dirty.stages[ShaderStage];
+
+    bool changed = false;
 
     for (uint32_t i = 0; i < NumSamplers; i++) {
       auto sampler = static_cast<D3D11SamplerState*>(ppSamplers[i]);
 
       if (bindings.samplers[StartSlot + i] != sampler) {
         bindings.samplers[StartSlot + i] = sampler;
-        BindSampler<ShaderStage>(slotId + i, sampler);
+        dirty.samplerMask |= 1u << (StartSlot + i);
+        changed = true;
       }
     }
 
     bindings.maxCount = std::clamp(StartSlot + NumSamplers,
       bindings.maxCount, uint32_t(bindings.samplers.size()));
+
+    if (changed) {
+      m_state.dirty.stageMask |= 1u << uint32_t(ShaderStage);
+      UpdateStateVersion(m_state.version.stages[uint32_t(ShaderStage)]);
+    }
   }
 
 
@@ -4943,7 +5213,10 @@ namespace dxvk {
         ResolveOmSrvHazards(dsv);
       }
 
-      m_state.om.maxRtv = NumRTVs;
+      if (m_state.om.maxRtv != NumRTVs) {
+        m_state.om.maxRtv = NumRTVs;
+        UpdateStateVersion(m_state.version.om);
+      }
     }
 
     if (unlikely(NumUAVs || m_state.om.maxUav)) {
@@ -4954,6 +5227,9 @@ namespace dxvk {
         uint32_t newMaxUav = NumUAVs ? UAVStartSlot + NumUAVs : 0;
         uint32_t oldMaxUav = std::exchange(m_state.om.maxUav, newMaxUav);
 
+        if (oldMaxUav != newMaxUav)
+          UpdateStateVersion(m_state.version.om);
+
         for (uint32_t i = 0; i < std::max(oldMaxUav, newMaxUav); i++) {
           D3D11UnorderedAccessView* uav = nullptr;
           uint32_t                  ctr = ~0u;
@@ -4965,6 +5241,7 @@ namespace dxvk {
 
           if (m_state.om.uavs[i] != uav || ctr != ~0u) {
             m_state.om.uavs[i] = uav;
+            UpdateStateVersion(m_state.version.om);
 
             BindUnorderedAccessView<DxbcProgramType::PixelShader>(
               uavSlotId + i, uav,
@@ -4980,6 +5257,7 @@ namespace dxvk {
     }
 
     if (needsUpdate) {
+      UpdateStateVersion(m_state.version.om);
       BindFramebuffer();
 
       if constexpr (!IsDeferred) {
@@ -5001,6 +5279,7 @@ namespace dxvk {
      || m_state.id.cntBuffer != cntBuffer) {
       m_state.id.argBuffer = argBuffer;
       m_state.id.cntBuffer = cntBuffer;
+      UpdateStateVersion(m_state.version.ia);
 
       BindDrawBuffers(argBuffer, cntBuffer);
     }
@@ -5193,7 +5472,7 @@ namespace dxvk {
     util::packImageData(stagingSlice.mapPtr(0),
       pSrcData, SrcRowPitch, SrcDepthPitch, 0, 0,
       pDstTexture->GetVkImageType(), extent, 1,
-      formatInfo, formatInfo->aspectMask);
+      formatInfo, formatInfo->aspectMask, true);
 
     UpdateImage(pDstTexture, &subresource,
       offset, extent, std::move(stagingSlice));
@@ -5212,7 +5491,61 @@ namespace dxvk {
     uint32_t dstSubresource = D3D11CalcSubresource(pDstSubresource->mipLevel,
       pDstSubresource->arrayLayer, pDstTexture->Desc()->MipLevels);
 
-    if (dstIsImage) {
+    auto dstFormatInfo = lookupFormatInfo(pDstTexture->GetPackedFormat());
+
+    if (dstIsImage && !dstFormatInfo->flags.test(DxvkFormatFlag::MultiPlane)
+     && !(dstFormatInfo->aspectMask & (dstFormatInfo->aspectMask - 1))) {
+      // Single-aspect images can batch consecutive updates from the
+      // same staging buffer into one copy, which helps applications
+      // that update many small textures or regions in a row.
+      VkBufferImageCopy region = { };
+      region.bufferOffset     = StagingBuffer.offset();
+      region.imageSubresource = vk::makeSubresourceLayers(*pDstSubresource);
+      region.imageOffset      = DstOffset;
+      region.imageExtent      = DstExtent;
+
+      auto dstImage = pDstTexture->GetImage();
+      auto cmdData = static_cast<D3D11CmdUpdateImageData*>(m_cmdData);
+
+      bool canMerge = cmdData
+        && cmdData->type == D3D11CmdType::UpdateImage
+        && cmdData->image == dstImage.ptr()
+        && cmdData->buffer == StagingBuffer.buffer().ptr()
+        && cmdData->regionCount < D3D11CmdUpdateImageData::MaxRegions;
+
+      // Regions written by the same copy command must not
+      // overlap, since the order of writes is undefined
+      for (uint32_t i = 0; canMerge && i < cmdData->regionCount; i++) {
+        const auto& other = cmdData->regions[i];
+
+        canMerge = other.imageSubresource.mipLevel       != region.imageSubresource.mipLevel
+                || other.imageSubresource.baseArrayLayer != region.imageSubresource.baseArrayLayer
+                || other.imageOffset.x + int32_t(other.imageExtent.width)  <= region.imageOffset.x
+                || other.imageOffset.y + int32_t(other.imageExtent.height) <= region.imageOffset.y
+                || other.imageOffset.z + int32_t(other.imageExtent.depth)  <= region.imageOffset.z
+                || region.imageOffset.x + int32_t(region.imageExtent.width)  <= other.imageOffset.x
+                || region.imageOffset.y + int32_t(region.imageExtent.height) <= other.imageOffset.y
+                || region.imageOffset.z + int32_t(region.imageExtent.depth)  <= other.imageOffset.z;
+      }
+
+      if (canMerge) {
+        cmdData->regions[cmdData->regionCount++] = region;
+      } else {
+        cmdData = EmitCsCmd<D3D11CmdUpdateImageData>([
+          cDstImage   = dstImage,
+          cSrcBuffer  = StagingBuffer.buffer()
+        ] (DxvkContext* ctx, const D3D11CmdUpdateImageData* data) {
+          ctx->copyBufferToImageRegions(cDstImage, cSrcBuffer,
+            data->regionCount, data->regions.data());
+        });
+
+        cmdData->type        = D3D11CmdType::UpdateImage;
+        cmdData->image       = dstImage.ptr();
+        cmdData->buffer      = StagingBuffer.buffer().ptr();
+        cmdData->regionCount = 1;
+        cmdData->regions[0]  = region;
+      }
+    } else if (dstIsImage) {
       EmitCs([
         cDstImage         = pDstTexture->GetImage(),
         cDstLayers        = vk::makeSubresourceLayers(*pDstSubresource),
@@ -5243,9 +5576,6 @@ namespace dxvk {
       // format metadata, so deal with it manually here.
       VkExtent3D dstMipExtent = pDstTexture->MipLevelExtent(pDstSubresource->mipLevel);
 
-      auto dstFormat = pDstTexture->GetPackedFormat();
-      auto dstFormatInfo = lookupFormatInfo(dstFormat);
-
       uint32_t planeCount = 1;
 
       if (dstFormatInfo->flags.test(DxvkFormatFlag::MultiPlane))
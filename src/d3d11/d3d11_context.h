@@ -766,6 +766,7 @@ namespace dxvk {
     Rc<DxvkDevice>              m_device;
 
     D3D11ContextState           m_state;
+    uint64_t                    m_stateVersion;
     UINT                        m_flags;
 
     DxvkStagingBuffer           m_staging;
@@ -800,6 +801,13 @@ namespace dxvk {
 
     void ApplyViewportState();
 
+    void ApplyDirtyGraphicsBindings();
+
+    void ApplyDirtyComputeBindings();
+
+    template<DxbcProgramType ShaderStage>
+    void ApplyDirtyBindings();
+
     template<DxbcProgramType ShaderStage>
     void BindShader(
       const D3D11CommonShader*                pShaderModule);
@@ -951,18 +959,31 @@ namespace dxvk {
             D3D11RenderTargetView*            pView);
 
     void RestoreCommandListState();
+
+    void RestoreChangedState(
+      const D3D11ContextStateVersion&         PrevVersion,
+      const D3D11MaxUsedBindings&             PrevBindings);
+
+    template<DxbcProgramType Stage>
+    void RestoreChangedStage(
+      const D3D11ContextStateVersion&         PrevVersion,
+      const D3D11MaxUsedBindings&             PrevBindings);
     
     template<DxbcProgramType Stage>
-    void RestoreConstantBuffers();
+    void RestoreConstantBuffers(
+            uint32_t                          MinCount = 0u);
     
     template<DxbcProgramType Stage>
-    void RestoreSamplers();
+    void RestoreSamplers(
+            uint32_t                          MinCount = 0u);
     
     template<DxbcProgramType Stage>
-    void RestoreShaderResources();
+    void RestoreShaderResources(
+            uint32_t                          MinCount = 0u);
     
     template<DxbcProgramType Stage>
-    void RestoreUnorderedAccessViews();
+    void RestoreUnorderedAccessViews(
+            uint32_t                          MinCount = 0u);
     
     template<DxbcProgramType ShaderStage>
     void SetConstantBuffers(
@@ -1016,6 +1037,11 @@ namespace dxvk {
     void TrackResourceSequenceNumber(
             ID3D11Resource*                   pResource);
 
+    void UpdateStateVersion(
+            uint64_t&                         Version) {
+      Version = ++m_stateVersion;
+    }
+
     void UpdateBuffer(
             D3D11Buffer*                      pDstBuffer,
             UINT                              Offset,
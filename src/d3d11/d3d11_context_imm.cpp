@@ -731,9 +731,6 @@ namespace dxvk {
     if (!pState)
       return;
 
-    // Reset all state affected by the current context state
-    ResetCommandListState();
-
     Com<D3D11DeviceContextState, false> oldState = std::move(m_stateObject);
     Com<D3D11DeviceContextState, false> newState = static_cast<D3D11DeviceContextState*>(pState);
 
@@ -745,11 +742,15 @@ namespace dxvk {
     
     m_stateObject = newState;
 
+    // Remember what is currently bound so that only state
+    // that differs between the two objects gets rebound
+    D3D11ContextStateVersion prevVersion = m_state.version;
+    D3D11MaxUsedBindings prevBindings = GetMaxUsedBindings();
+
     oldState->SetState(m_state);
     newState->GetState(m_state);
 
-    // Restore all state affected by the new context state
-    RestoreCommandListState();
+    RestoreChangedState(prevVersion, prevBindings);
   }
 
 
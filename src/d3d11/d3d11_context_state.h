@@ -115,6 +115,44 @@ namespace dxvk {
     
   using D3D11SamplerBindings = D3D11ShaderStageState<D3D11ShaderStageSamplerBinding>;
 
+  /**
+   * \brief Pending resource bindings
+   *
+   * Stores which constant buffer, shader resource and sampler
+   * slots were changed by the application since they were last
+   * applied to the DXVK context. Changes are only translated to
+   * CS commands right before the next draw or dispatch, so that
+   * slots overwritten in between do not cost anything. All slot
+   * indices are below the \c maxCount of the respective binding.
+   */
+  struct D3D11ShaderStageDirtyBindings {
+    uint32_t                                                     cbvMask      = 0u;
+    uint32_t                                                     cbvRangeMask = 0u;
+    uint32_t                                                     samplerMask  = 0u;
+    DxvkBindingSet<D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT> srvMask      = { };
+
+    void reset() {
+      cbvMask = 0u;
+      cbvRangeMask = 0u;
+      samplerMask = 0u;
+      srvMask.clear();
+    }
+  };
+
+  struct D3D11DirtyBindings {
+    D3D11ShaderStageState<D3D11ShaderStageDirtyBindings> stages;
+
+    /// Bit mask of shader stages with pending bindings
+    uint32_t stageMask = 0u;
+
+    void reset() {
+      if (stageMask) {
+        stages.reset();
+        stageMask = 0u;
+      }
+    }
+  };
+
   /**
    * \brief UAV bindings
    *
@@ -303,6 +341,29 @@ namespace dxvk {
     }
   };
   
+  /**
+   * \brief Context state versions
+   *
+   * Each state group is assigned a new, unique version number
+   * whenever it gets modified, and version zero denotes default
+   * state. Two context states with the same version for a group
+   * are therefore identical for that group, which allows context
+   * state objects to skip copying and rebinding unchanged state.
+   */
+  struct D3D11ContextStateVersion {
+    /// Shader and resource bindings per stage, indexed
+    /// by program type. Includes compute shader UAVs.
+    std::array<uint64_t, 6> stages = { };
+    /// Input assembly and indirect draw buffers
+    uint64_t ia = 0u;
+    /// Output merger state, including graphics UAVs
+    uint64_t om = 0u;
+    /// Rasterizer state, viewports and scissors
+    uint64_t rs = 0u;
+    /// Stream output targets
+    uint64_t so = 0u;
+  };
+
   /**
    * \brief Context state
    */
@@ -325,6 +386,10 @@ namespace dxvk {
     D3D11SrvBindings    srv;
     D3D11UavBindings    uav;
     D3D11SamplerBindings samplers;
+
+    D3D11DirtyBindings  dirty;
+
+    D3D11ContextStateVersion version;
   };
 
   /**
@@ -2396,7 +2396,7 @@ namespace dxvk {
 
         util::packImageData(mapPtr, srcData, RowPitch, DepthPitch,
           layout.RowPitch, layout.DepthPitch, image->info().type,
-          extent, 1, formatInfo, aspect);
+          extent, 1, formatInfo, aspect, true);
       } else {
         // ReadFromSubresource
         auto dstData = reinterpret_cast<char*>(pData) + dataOffset;
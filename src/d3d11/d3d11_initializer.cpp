@@ -178,7 +178,7 @@ namespace dxvk {
           if (mapMode != D3D11_COMMON_TEXTURE_MAP_MODE_NONE) {
             util::packImageData(pTexture->GetMappedBuffer(id)->mapPtr(0),
               pInitialData[id].pSysMem, pInitialData[id].SysMemPitch, pInitialData[id].SysMemSlicePitch,
-              0, 0, pTexture->GetVkImageType(), mipLevelExtent, 1, formatInfo, formatInfo->aspectMask);
+              0, 0, pTexture->GetVkImageType(), mipLevelExtent, 1, formatInfo, formatInfo->aspectMask, true);
           }
         }
       }
@@ -37,4 +37,62 @@ namespace dxvk {
     return E_NOINTERFACE;
   }
 
+
+  void D3D11DeviceContextState::CopyState(
+          D3D11ContextState&    Dst,
+    const D3D11ContextState&    Src) {
+    auto& dstVersion = Dst.version;
+    auto& srcVersion = Src.version;
+
+    // Shader stages, including compute UAVs
+    for (uint32_t i = 0; i < srcVersion.stages.size(); i++) {
+      if (dstVersion.stages[i] == srcVersion.stages[i])
+        continue;
+
+      auto stage = DxbcProgramType(i);
+
+      switch (stage) {
+        case DxbcProgramType::VertexShader:   Dst.vs = Src.vs; break;
+        case DxbcProgramType::HullShader:     Dst.hs = Src.hs; break;
+        case DxbcProgramType::DomainShader:   Dst.ds = Src.ds; break;
+        case DxbcProgramType::GeometryShader: Dst.gs = Src.gs; break;
+        case DxbcProgramType::PixelShader:    Dst.ps = Src.ps; break;
+        case DxbcProgramType::ComputeShader:  Dst.cs = Src.cs;
+                                              Dst.uav = Src.uav; break;
+        default: break;
+      }
+
+      Dst.cbv[stage] = Src.cbv[stage];
+      Dst.srv[stage] = Src.srv[stage];
+      Dst.samplers[stage] = Src.samplers[stage];
+
+      dstVersion.stages[i] = srcVersion.stages[i];
+    }
+
+    if (dstVersion.ia != srcVersion.ia) {
+      Dst.ia = Src.ia;
+      Dst.id = Src.id;
+      dstVersion.ia = srcVersion.ia;
+    }
+
+    if (dstVersion.om != srcVersion.om) {
+      Dst.om = Src.om;
+      dstVersion.om = srcVersion.om;
+    }
+
+    if (dstVersion.rs != srcVersion.rs) {
+      Dst.rs = Src.rs;
+      dstVersion.rs = srcVersion.rs;
+    }
+
+    if (dstVersion.so != srcVersion.so) {
+      Dst.so = Src.so;
+      dstVersion.so = srcVersion.so;
+    }
+
+    // Predication is not versioned and cheap to copy. Pending
+    // bindings belong to the context, so they are not copied.
+    Dst.pr = Src.pr;
+  }
+
 }
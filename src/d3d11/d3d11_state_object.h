@@ -27,18 +27,36 @@ namespace dxvk {
             REFIID                riid,
             void**                ppvObject);
     
+    /**
+     * \brief Stores context state
+     *
+     * Only copies state groups whose version differs
+     * from the version currently stored in the object.
+     * \param [in] State Context state to store
+     */
     void SetState(const D3D11ContextState& State) {
-      m_state = State;
+      CopyState(m_state, State);
     }
 
+    /**
+     * \brief Loads context state
+     *
+     * Only copies state groups whose version differs
+     * from the version of the given context state.
+     * \param [out] State Context state to update
+     */
     void GetState(D3D11ContextState& State) const {
-      State = m_state;
+      CopyState(State, m_state);
     }
 
   private:
 
     D3D11ContextState m_state;
 
+    static void CopyState(
+            D3D11ContextState&    Dst,
+      const D3D11ContextState&    Src);
+
   };
 
 }
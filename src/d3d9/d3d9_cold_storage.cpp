@@ -0,0 +1,102 @@
+#include "d3d9_cold_storage.h"
+
+#include "../util/util_lz.h"
+
+namespace dxvk {
+
+  D3D9ColdStorage::D3D9ColdStorage() {
+
+  }
+
+
+  D3D9ColdStorage::~D3D9ColdStorage() {
+    if (m_thread.joinable()) {
+      { std::unique_lock<dxvk::mutex> lock(m_mutex);
+        m_running = false;
+        m_condVar.notify_one();
+      }
+
+      m_thread.join();
+    }
+  }
+
+
+  Rc<D3D9ColdStorageJob> D3D9ColdStorage::Compress(
+    const Rc<DxvkBuffer>&     Buffer,
+          size_t              Size) {
+    Rc<D3D9ColdStorageJob> job = new D3D9ColdStorageJob(Buffer, Size);
+
+    std::unique_lock<dxvk::mutex> lock(m_mutex);
+    m_queue.push(job);
+
+    // Only spin up the worker once it is actually needed
+    if (!m_running) {
+      m_running = true;
+      m_thread = dxvk::thread([this] { RunWorker(); });
+    } else {
+      m_condVar.notify_one();
+    }
+
+    return job;
+  }
+
+
+  void D3D9ColdStorage::Decompress(
+    const std::vector<uint8_t>& Data,
+          void*               pDst,
+          size_t              Size) {
+    if (unlikely(!lz::decompress(Data.data(), Data.size(), pDst, Size)))
+      Logger::err("D3D9: Failed to decompress cold texture data");
+  }
+
+
+  void D3D9ColdStorage::RunWorker() {
+    env::setThreadName("dxvk-cold");
+
+    while (true) {
+      Rc<D3D9ColdStorageJob> job;
+
+      { std::unique_lock<dxvk::mutex> lock(m_mutex);
+
+        m_condVar.wait(lock, [this] {
+          return !m_queue.empty() || !m_running;
+        });
+
+        if (!m_running)
+          return;
+
+        job = std::move(m_queue.front());
+        m_queue.pop();
+      }
+
+      if (!job->m_cancelled.load(std::memory_order_acquire)) {
+        // Only keep the compressed data if it saves a reasonable
+        // amount of memory, decompression is not entirely free.
+        // The compressor stops once the output exceeds that size,
+        // so the scratch buffer never needs to be any larger.
+        size_t maxSize = job->m_size - job->m_size / 8;
+
+        if (m_scratch.size() < maxSize)
+          m_scratch.resize(maxSize);
+
+        size_t size = lz::compress(job->m_buffer->mapPtr(0),
+          job->m_size, m_scratch.data(), maxSize);
+
+        if (size)
+          job->m_data.assign(m_scratch.begin(), m_scratch.begin() + size);
+      }
+
+      // The buffer may be released as soon as the job is done
+      job->m_buffer = nullptr;
+      job->m_done.store(true, std::memory_order_release);
+
+      // Don't hold on to scratch memory while idle
+      { std::unique_lock<dxvk::mutex> lock(m_mutex);
+
+        if (m_queue.empty())
+          m_scratch = std::vector<uint8_t>();
+      }
+    }
+  }
+
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <atomic>
+#include <queue>
+#include <vector>
+
+#include "../dxvk/dxvk_buffer.h"
+
+#include "../util/thread.h"
+
+namespace dxvk {
+
+  /**
+   * \brief Cold storage statistics
+   */
+  struct D3D9ColdStorageStats {
+    /// Uncompressed size of all cold texture data
+    uint64_t storedSize     = 0;
+    /// Actual size of the compressed data
+    uint64_t compressedSize = 0;
+  };
+
+
+  /**
+   * \brief Cold storage compression job
+   *
+   * Compresses the contents of a mapping buffer on the
+   * cold storage worker. The buffer must not be written
+   * while the job is pending, otherwise it must be
+   * cancelled and the result is discarded.
+   */
+  class D3D9ColdStorageJob : public RcObject {
+    friend class D3D9ColdStorage;
+  public:
+
+    D3D9ColdStorageJob(
+      const Rc<DxvkBuffer>&     Buffer,
+            size_t              Size)
+    : m_buffer(Buffer), m_size(Size) { }
+
+    /**
+     * \brief Checks whether the job has completed
+     * \returns \c true if the result is available
+     */
+    bool IsDone() const {
+      return m_done.load(std::memory_order_acquire);
+    }
+
+    /**
+     * \brief Cancels the job
+     *
+     * The worker will skip the job if it has not
+     * started yet, and the result must not be used.
+     */
+    void Cancel() {
+      m_cancelled.store(true, std::memory_order_release);
+    }
+
+    /**
+     * \brief Retrieves compressed data
+     *
+     * Only valid once the job is done. The returned
+     * data is empty if compression was not worthwhile.
+     * \returns Compressed data
+     */
+    std::vector<uint8_t> TakeData() {
+      return std::move(m_data);
+    }
+
+  private:
+
+    Rc<DxvkBuffer>        m_buffer;
+    size_t                m_size;
+    std::vector<uint8_t>  m_data;
+
+    std::atomic<bool>     m_done      = { false };
+    std::atomic<bool>     m_cancelled = { false };
+
+  };
+
+
+  /**
+   * \brief Cold storage for texture data
+   *
+   * Compresses system memory copies of textures which
+   * have not been used in a while on a worker thread,
+   * and keeps track of the memory saved that way.
+   */
+  class D3D9ColdStorage {
+
+  public:
+
+    D3D9ColdStorage();
+
+    ~D3D9ColdStorage();
+
+    /**
+     * \brief Queues buffer for compression
+     *
+     * \param [in] Buffer Buffer to compress
+     * \param [in] Size Number of bytes to compress
+     * \returns Compression job
+     */
+    Rc<D3D9ColdStorageJob> Compress(
+      const Rc<DxvkBuffer>&     Buffer,
+            size_t              Size);
+
+    /**
+     * \brief Decompresses cold data
+     *
+     * \param [in] Data Compressed data
+     * \param [out] pDst Destination pointer
+     * \param [in] Size Uncompressed size
+     */
+    void Decompress(
+      const std::vector<uint8_t>& Data,
+            void*               pDst,
+            size_t              Size);
+
+    /**
+     * \brief Registers compressed data
+     *
+     * Called when a texture starts using compressed data.
+     * \param [in] StoredSize Uncompressed size
+     * \param [in] CompressedSize Compressed size
+     */
+    void NotifyStored(size_t StoredSize, size_t CompressedSize) {
+      m_storedSize     += StoredSize;
+      m_compressedSize += CompressedSize;
+    }
+
+    /**
+     * \brief Unregisters compressed data
+     *
+     * \param [in] StoredSize Uncompressed size
+     * \param [in] CompressedSize Compressed size
+     */
+    void NotifyReleased(size_t StoredSize, size_t CompressedSize) {
+      m_storedSize     -= StoredSize;
+      m_compressedSize -= CompressedSize;
+    }
+
+    /**
+     * \brief Queries cold storage statistics
+     * \returns Current statistics
+     */
+    D3D9ColdStorageStats GetStats() const {
+      D3D9ColdStorageStats result;
+      result.storedSize     = m_storedSize.load();
+      result.compressedSize = m_compressedSize.load();
+      return result;
+    }
+
+  private:
+
+    dxvk::mutex                         m_mutex;
+    dxvk::condition_variable            m_condVar;
+    std::queue<Rc<D3D9ColdStorageJob>>  m_queue;
+    bool                                m_running = false;
+    dxvk::thread                        m_thread;
+
+    std::vector<uint8_t>                m_scratch;
+
+    std::atomic<uint64_t>               m_storedSize     = { 0ull };
+    std::atomic<uint64_t>               m_compressedSize = { 0ull };
+
+    void RunWorker();
+
+  };
+
+}
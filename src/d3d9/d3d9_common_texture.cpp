@@ -99,6 +99,13 @@ namespace dxvk {
       m_device->ChangeReportedMemory(m_size);
 
     m_device->RemoveMappedTexture(this);
+    m_device->RemoveColdTexture(this);
+
+    if (m_coldJob != nullptr)
+      m_coldJob->Cancel();
+
+    if (!m_coldData.empty())
+      m_device->GetColdStorage()->NotifyReleased(m_totalSize, m_coldData.size());
 
     if (m_desc.Pool == D3DPOOL_DEFAULT)
       m_device->DecrementLosableCounter();
@@ -189,6 +196,9 @@ namespace dxvk {
 
 
   void* D3D9CommonTexture::GetData(UINT Subresource) {
+    if (unlikely(m_coldJob != nullptr || !m_coldData.empty()))
+      RestoreColdData();
+
     if (unlikely(m_buffer != nullptr))
       return m_buffer->mapPtr(m_memoryOffset[Subresource]);
 
@@ -200,6 +210,9 @@ namespace dxvk {
 
 
   void D3D9CommonTexture::CreateBuffer(bool Initialize) {
+    if (unlikely(m_coldJob != nullptr || !m_coldData.empty()))
+      RestoreColdData();
+
     if (likely(m_buffer != nullptr))
       return;
 
@@ -685,10 +698,84 @@ namespace dxvk {
 
 
   const Rc<DxvkBuffer>& D3D9CommonTexture::GetBuffer() {
+    // The buffer may be written by the GPU, e.g. for readbacks,
+    // so any pending compression job must be cancelled as well
+    if (unlikely(m_coldJob != nullptr || !m_coldData.empty()))
+      RestoreColdData();
+
     return m_buffer;
   }
 
 
+  bool D3D9CommonTexture::CanMoveToColdStorage() const {
+    if (m_buffer == nullptr || m_coldJob != nullptr)
+      return false;
+
+    // Non-managed textures with a backing image keep their
+    // buffer around only as a staging buffer, if at all.
+    bool isSysmemCopy = IsManaged()
+      ? m_mapMode == D3D9_COMMON_TEXTURE_MAP_MODE_BACKED
+      : m_mapMode == D3D9_COMMON_TEXTURE_MAP_MODE_SYSTEMMEM;
+
+    return isSysmemCopy
+        && !IsAnySubresourceLocked()
+        && !m_needsReadback.any()
+        && !m_needsUpload.any();
+  }
+
+
+  bool D3D9CommonTexture::StartColdStorage(D3D9ColdStorage& Storage) {
+    if (!CanMoveToColdStorage())
+      return false;
+
+    m_coldJob = Storage.Compress(m_buffer, m_totalSize);
+    return true;
+  }
+
+
+  bool D3D9CommonTexture::FinishColdStorage() {
+    if (m_coldJob == nullptr)
+      return true;
+
+    if (!m_coldJob->IsDone())
+      return false;
+
+    std::vector<uint8_t> data = m_coldJob->TakeData();
+    m_coldJob = nullptr;
+
+    if (!data.empty() && CanMoveToColdStorage()) {
+      m_coldData = std::move(data);
+      m_buffer = nullptr;
+
+      m_device->GetColdStorage()->NotifyStored(m_totalSize, m_coldData.size());
+    }
+
+    return true;
+  }
+
+
+  void D3D9CommonTexture::RestoreColdData() {
+    // Any pending job may read data that is about to be
+    // modified, so its result must be discarded.
+    if (m_coldJob != nullptr) {
+      m_coldJob->Cancel();
+      m_coldJob = nullptr;
+    }
+
+    if (m_coldData.empty())
+      return;
+
+    D3D9ColdStorage* storage = m_device->GetColdStorage();
+    std::vector<uint8_t> data = std::move(m_coldData);
+    m_coldData.clear();
+
+    CreateBuffer(false);
+
+    storage->Decompress(data, m_buffer->mapPtr(0), m_totalSize);
+    storage->NotifyReleased(m_totalSize, data.size());
+  }
+
+
   DxvkBufferSlice D3D9CommonTexture::GetBufferSlice(UINT Subresource) {
     return DxvkBufferSlice(GetBuffer(), m_memoryOffset[Subresource], GetMipSize(Subresource));
   }
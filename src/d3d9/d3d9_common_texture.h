@@ -3,6 +3,7 @@
 #include "d3d9_format.h"
 #include "d3d9_util.h"
 #include "d3d9_caps.h"
+#include "d3d9_cold_storage.h"
 #include "d3d9_mem.h"
 #include "d3d9_interop.h"
 
@@ -233,6 +234,60 @@ namespace dxvk {
       m_data.Unmap();
     }
 
+    /**
+     * \brief Checks whether the texture data is compressed
+     * \returns \c true if the mapping buffer has been
+     *    replaced with compressed data
+     */
+    bool IsCold() const {
+      return !m_coldData.empty();
+    }
+
+    /**
+     * \brief Checks whether the texture data can be compressed
+     *
+     * Only textures whose mapping buffer holds the only or
+     * an up-to-date copy of the data, and which are neither
+     * locked nor waiting for a GPU readback qualify.
+     * \returns \c true if compression can be started
+     */
+    bool CanMoveToColdStorage() const;
+
+    /**
+     * \brief Starts compressing texture data
+     *
+     * \param [in] Storage Cold storage to use
+     * \returns \c true if a compression job was queued
+     */
+    bool StartColdStorage(D3D9ColdStorage& Storage);
+
+    /**
+     * \brief Finishes pending compression job
+     *
+     * Replaces the mapping buffer with the compressed
+     * data if compression was successful.
+     * \returns \c true if there is no pending job anymore
+     */
+    bool FinishColdStorage();
+
+    /**
+     * \brief Time of last access
+     *
+     * Used to determine whether texture data is cold.
+     * \returns Time when the texture was last unlocked
+     */
+    dxvk::high_resolution_clock::time_point GetLastAccess() const {
+      return m_lastAccess;
+    }
+
+    /**
+     * \brief Sets time of last access
+     * \param [in] Time Current time
+     */
+    void SetLastAccess(dxvk::high_resolution_clock::time_point Time) {
+      m_lastAccess = Time;
+    }
+
     /**
      * \brief Destroys a buffer
      * Destroys mapping and staging buffers for a given subresource
@@ -497,6 +552,11 @@ namespace dxvk {
     Rc<DxvkBuffer>                m_buffer;
     D3D9Memory                    m_data = { };
 
+    Rc<D3D9ColdStorageJob>        m_coldJob;
+    std::vector<uint8_t>          m_coldData;
+
+    dxvk::high_resolution_clock::time_point m_lastAccess = { };
+
     D3D9SubresourceArray<
       uint64_t>                   m_seqs = { };
 
@@ -558,6 +618,8 @@ namespace dxvk {
 
     void ExportImageInfo();
 
+    void RestoreColdData();
+
     static VkImageViewType GetImageViewTypeFromResourceType(
             D3DRESOURCETYPE  Dimension,
             UINT             Layer);
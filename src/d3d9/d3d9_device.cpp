@@ -2430,6 +2430,8 @@ namespace dxvk {
     if (unlikely(ppSB == nullptr || m_recorder == nullptr))
       return D3DERR_INVALIDCALL;
 
+    m_recorder->Compile();
+
     *ppSB = m_recorder.ref();
     if (!m_isD3D8Compatible)
       m_losableResourceCounter++;
@@ -2753,28 +2755,22 @@ namespace dxvk {
 
     uint32_t vertexCount = GetVertexCount(PrimitiveType, PrimitiveCount);
 
-    const uint32_t dataSize = GetUPDataSize(vertexCount, VertexStreamZeroStride);
-    const uint32_t bufferSize = GetUPBufferSize(vertexCount, VertexStreamZeroStride);
+    if (!TryMergeUPDraw(PrimitiveType, vertexCount, pVertexStreamZeroData, VertexStreamZeroStride)) {
+      FlushUPDraw();
 
-    auto upSlice = AllocUPBuffer(bufferSize);
-    FillUPVertexBuffer(upSlice.mapPtr, pVertexStreamZeroData, dataSize, bufferSize);
+      const uint32_t dataSize = GetUPDataSize(vertexCount, VertexStreamZeroStride);
+      const uint32_t bufferSize = GetUPBufferSize(vertexCount, VertexStreamZeroStride);
 
-    EmitCs([this,
-      cBufferSlice  = std::move(upSlice.slice),
-      cPrimType     = PrimitiveType,
-      cStride       = VertexStreamZeroStride,
-      cVertexCount  = vertexCount
-    ](DxvkContext* ctx) mutable {
-      ApplyPrimitiveType(ctx, cPrimType);
-
-      // Tests on Windows show that D3D9 does not do non-indexed instanced draws.
+      auto upSlice = AllocUPBuffer(bufferSize);
+      FillUPVertexBuffer(upSlice.mapPtr, pVertexStreamZeroData, dataSize, bufferSize);
 
-      ctx->bindVertexBuffer(0, std::move(cBufferSlice), cStride);
-      ctx->draw(
-        cVertexCount, 1,
-        0, 0);
-      ctx->bindVertexBuffer(0, DxvkBufferSlice(), 0);
-    });
+      // The draw itself is recorded once any other command
+      // gets emitted, so that subsequent UP draws can be merged
+      m_upDraw.slice       = std::move(upSlice.slice);
+      m_upDraw.primType    = PrimitiveType;
+      m_upDraw.stride      = VertexStreamZeroStride;
+      m_upDraw.vertexCount = vertexCount;
+    }
 
     m_state.vertexBuffers[0].vertexBuffer = nullptr;
     m_state.vertexBuffers[0].offset       = 0;
@@ -3277,9 +3273,13 @@ namespace dxvk {
     auto& vbo = m_state.vertexBuffers[StreamNumber];
     bool needsUpdate = vbo.vertexBuffer != buffer;
 
-    if (needsUpdate)
+    if (needsUpdate) {
       vbo.vertexBuffer = buffer;
 
+      // The new buffer may have pending uploads
+      m_stateEpoch += 1;
+    }
+
     if (buffer != nullptr) {
       needsUpdate |= vbo.offset != OffsetInBytes
                   || vbo.stride != Stride;
@@ -3396,6 +3396,9 @@ namespace dxvk {
 
     m_state.indices = buffer;
 
+    // The new buffer may have pending uploads
+    m_stateEpoch += 1;
+
     if (buffer != nullptr)
       BindIndices();
 
@@ -3464,7 +3467,12 @@ namespace dxvk {
     bool oldCopies = oldShader && oldShader->GetMeta().needsConstantCopies;
     bool newCopies = newShader && newShader->GetMeta().needsConstantCopies;
 
-    m_consts[DxsoProgramTypes::PixelShader].dirty |= oldCopies || newCopies || !oldShader;
+    // Push constants and the constant buffer are only
+    // updated for shaders that actually read them
+    bool oldPush = oldShader && oldShader->GetMeta().pushConstantFloats;
+    bool newPush = newShader && newShader->GetMeta().pushConstantFloats;
+
+    m_consts[DxsoProgramTypes::PixelShader].dirty |= oldCopies || newCopies || oldPush || newPush || !oldShader;
     m_consts[DxsoProgramTypes::PixelShader].meta  = newShader ? newShader->GetMeta() : DxsoShaderMetaInfo();
 
     if (newShader && oldShader) {
@@ -4278,8 +4286,6 @@ namespace dxvk {
 
 
   D3D9BufferSlice D3D9DeviceEx::AllocUPBuffer(VkDeviceSize size) {
-    constexpr VkDeviceSize UPBufferSize = 1 << 20;
-
     if (unlikely(m_upBuffer == nullptr || size > UPBufferSize)) {
       VkMemoryPropertyFlags memoryFlags
         = VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
@@ -4333,6 +4339,77 @@ namespace dxvk {
   }
 
 
+  bool D3D9DeviceEx::TryMergeUPDraw(
+          D3DPRIMITIVETYPE  PrimitiveType,
+          uint32_t          VertexCount,
+    const void*             pVertexData,
+          uint32_t          Stride) {
+    // Any state change since the pending draw would have emitted a
+    // command and thus flushed it, so the state is known to match.
+    // Strips and fans can not be concatenated without restarts.
+    bool isList = PrimitiveType == D3DPT_POINTLIST
+               || PrimitiveType == D3DPT_LINELIST
+               || PrimitiveType == D3DPT_TRIANGLELIST;
+
+    if (!m_upDraw.vertexCount || !isList
+     || m_upDraw.primType != PrimitiveType
+     || m_upDraw.stride   != Stride)
+      return false;
+
+    // Vertex data needs to be tightly packed, otherwise the zero
+    // padding of the previous draw would get overwritten.
+    VkDeviceSize prevSize = VkDeviceSize(m_upDraw.vertexCount) * Stride;
+    VkDeviceSize dataSize = VkDeviceSize(VertexCount) * Stride;
+
+    if (m_state.vertexDecl->GetSize(0) > Stride
+     || m_upDraw.slice.length() != prevSize
+     || m_upDraw.slice.buffer() != m_upBuffer)
+      return false;
+
+    // Only append if nothing else was allocated from
+    // the UP buffer since, and if the data still fits
+    VkDeviceSize offset = m_upDraw.slice.offset() + prevSize;
+
+    if (align(offset, CACHE_LINE_SIZE) != m_upBufferOffset
+     || offset + dataSize > UPBufferSize)
+      return false;
+
+    std::memcpy(reinterpret_cast<char*>(m_upBufferMapPtr) + offset, pVertexData, dataSize);
+
+    m_upDraw.slice = DxvkBufferSlice(m_upBuffer, m_upDraw.slice.offset(), prevSize + dataSize);
+    m_upDraw.vertexCount += VertexCount;
+
+    m_upBufferOffset = align(offset + dataSize, CACHE_LINE_SIZE);
+    return true;
+  }
+
+
+  void D3D9DeviceEx::FlushUPDraw() {
+    if (!m_upDraw.vertexCount)
+      return;
+
+    // Reset the batch first since EmitCs would flush it again
+    D3D9UPDrawBatch draw = std::exchange(m_upDraw, D3D9UPDrawBatch());
+
+    EmitCs([this,
+      cBufferSlice  = std::move(draw.slice),
+      cPrimType     = draw.primType,
+      cStride       = draw.stride,
+      cVertexCount  = draw.vertexCount
+    ](DxvkContext* ctx) mutable {
+      ApplyPrimitiveType(ctx, cPrimType);
+
+      // Tests on Windows show that D3D9 does not do non-indexed instanced draws.
+
+      ctx->bindVertexBuffer(0, std::move(cBufferSlice), cStride);
+      ctx->draw(
+        cVertexCount, 1,
+        0, 0);
+      ctx->bindVertexBuffer(0, DxvkBufferSlice(), 0);
+    });
+  }
+
+
   D3D9BufferSlice D3D9DeviceEx::AllocStagingBuffer(VkDeviceSize size) {
     m_stagingBufferAllocated += size;
 
@@ -4771,6 +4848,9 @@ namespace dxvk {
     MapTexture(pResource, Subresource); // Add it to the list of mapped resources
     pResource->SetLocked(Subresource, false);
 
+    if (!pResource->IsAnySubresourceLocked())
+      TouchColdTexture(pResource);
+
     // Flush image contents from staging if we aren't read only
     // and we aren't deferring for managed.
     const D3DBOX& box = pResource->GetDirtyBox(Face);
@@ -4896,7 +4976,7 @@ namespace dxvk {
       const void* srcData = reinterpret_cast<const uint8_t*>(mapPtr) + copySrcOffset;
       util::packImageData(
         slice.mapPtr, srcData, extentBlockCount, formatInfo->elementSize,
-        pitch, pitch * srcTexLevelExtentBlockCount.height);
+        pitch, pitch * srcTexLevelExtentBlockCount.height, true);
 
       VkFormat packedDSFormat = GetPackedDepthStencilFormat(pDestTexture->Desc()->Format);
 
@@ -4960,10 +5040,18 @@ namespace dxvk {
 
       util::packImageData(
         slice.mapPtr, mapPtr, srcBlockCount, formatElementSize,
-        pitch, std::min(pSrcTexture->GetPlaneCount(), 2u) * pitch * srcBlockCount.height);
+        pitch, std::min(pSrcTexture->GetPlaneCount(), 2u) * pitch * srcBlockCount.height, true);
 
-      Flush();
-      SynchronizeCsThread(DxvkCsThread::SynchronizeAll);
+      // Conversions are submitted ahead of the next command list, so any
+      // prior work must be submitted first. If nothing was recorded since
+      // the last conversion, this already happened and the conversion can
+      // be batched with the previous one.
+      if (GetCurrentSequenceNumber() != m_converterSeqNum) {
+        Flush();
+        SynchronizeCsThread(DxvkCsThread::SynchronizeAll);
+
+        m_converterSeqNum = GetCurrentSequenceNumber();
+      }
 
       m_converter->ConvertFormat(
         convertFormat,
@@ -5032,9 +5120,13 @@ namespace dxvk {
     uint32_t size   = respectUserBounds ? std::min(SizeToLock, desc.Size - offset) : desc.Size;
     D3D9Range lockRange = D3D9Range(offset, offset + size);
 
-    if ((desc.Pool == D3DPOOL_DEFAULT || !(Flags & D3DLOCK_NO_DIRTY_UPDATE)) && !(Flags & D3DLOCK_READONLY))
+    if ((desc.Pool == D3DPOOL_DEFAULT || !(Flags & D3DLOCK_NO_DIRTY_UPDATE)) && !(Flags & D3DLOCK_READONLY)) {
       pResource->DirtyRange().Conjoin(lockRange);
 
+      // Bound buffers may need to be uploaded before the next draw
+      m_stateEpoch += 1;
+    }
+
     const bool directMapping = pResource->GetMapMode() == D3D9_COMMON_BUFFER_MAP_MODE_DIRECT;
     const bool needsReadback = pResource->NeedsReadback();
 
@@ -5512,13 +5604,54 @@ namespace dxvk {
   }
 
 
+  static void CopyConstantData(void* dst, const void* src, size_t size) {
+#ifdef DXVK_ARCH_X86
+    // Constant buffers are typically mapped write-combined, so use
+    // non-temporal stores in order to not pollute the cache with
+    // data that the CPU will never read back.
+    auto dstBytes = reinterpret_cast<char*>(dst);
+    auto srcBytes = reinterpret_cast<const char*>(src);
+
+    // Slices may only be aligned to a few bytes, but
+    // streaming stores require an aligned destination
+    size_t head = std::min(size, size_t(-reinterpret_cast<uintptr_t>(dst) & (sizeof(__m128i) - 1)));
+
+    if (unlikely(head)) {
+      std::memcpy(dstBytes, srcBytes, head);
+      dstBytes += head;
+      srcBytes += head;
+      size -= head;
+    }
+
+    auto dstVec = reinterpret_cast<__m128i*>(dstBytes);
+    auto srcVec = reinterpret_cast<const __m128i*>(srcBytes);
+
+    size_t count = size / sizeof(__m128i);
+
+    for (size_t i = 0; i < count; i++)
+      _mm_stream_si128(dstVec + i, _mm_loadu_si128(srcVec + i));
+
+    _mm_sfence();
+
+    size_t tail = count * sizeof(__m128i);
+
+    if (unlikely(tail < size))
+      std::memcpy(dstBytes + tail, srcBytes + tail, size - tail);
+#else
+    std::memcpy(dst, src, size);
+#endif
+  }
+
+
   inline void* D3D9DeviceEx::CopySoftwareConstants(D3D9ConstantBuffer& dstBuffer, const void* src, uint32_t size) {
     uint32_t alignment = dstBuffer.GetAlignment();
     size = std::max(size, alignment);
     size = align(size, alignment);
 
     auto mapPtr = dstBuffer.Alloc(size);
-    std::memcpy(mapPtr, src, size);
+    CopyConstantData(mapPtr, src, size);
+
+    m_uploadedConstants.fetch_add(size / sizeof(Vector4), std::memory_order_relaxed);
     return mapPtr;
   }
 
@@ -5536,6 +5669,28 @@ namespace dxvk {
 
     constSet.dirty = false;
 
+    if (constSet.meta.pushConstantFloats) {
+      // The shader reads its float constants from push constants
+      // and uses no other constants, so skip the buffer entirely.
+      uint32_t pushCount = std::min(constSet.meta.maxConstIndexF, D3D9PushConstantFloatCount);
+
+      if (pushCount) {
+        std::array<Vector4, D3D9PushConstantFloatCount> data;
+        std::memcpy(data.data(), Src.fConsts, pushCount * sizeof(Vector4));
+
+        EmitCs([
+          cData = data,
+          cSize = pushCount * uint32_t(sizeof(Vector4))
+        ] (DxvkContext* ctx) {
+          ctx->pushConstants(D3D9PushConstantFloatOffset, cSize, cData.data());
+        });
+
+        m_uploadedConstants.fetch_add(pushCount, std::memory_order_relaxed);
+      }
+
+      return;
+    }
+
     uint32_t floatCount = ShaderStage == DxsoProgramType::VertexShader ? m_vsFloatConstsCount : m_psFloatConstsCount;
     if (constSet.meta.needsConstantCopies) {
       auto shader = GetCommonShader(Shader);
@@ -5554,9 +5709,11 @@ namespace dxvk {
     auto* dst = reinterpret_cast<HardwareLayoutType*>(mapPtr);
 
     if (constSet.meta.maxConstIndexI != 0)
-      std::memcpy(dst->iConsts, Src.iConsts, intDataSize);
+      CopyConstantData(dst->iConsts, Src.iConsts, intDataSize);
     if (constSet.meta.maxConstIndexF != 0)
-      std::memcpy(dst->fConsts, Src.fConsts, floatDataSize);
+      CopyConstantData(dst->fConsts, Src.fConsts, floatDataSize);
+
+    m_uploadedConstants.fetch_add((intDataSize + floatDataSize) / sizeof(Vector4), std::memory_order_relaxed);
 
     if (constSet.meta.needsConstantCopies) {
       Vector4* data = reinterpret_cast<Vector4*>(dst->fConsts);
@@ -5725,6 +5882,10 @@ namespace dxvk {
     EmitCs<false>([] (DxvkContext* ctx) {
       ctx->endFrame();
     });
+
+    ProcessColdTextures();
+
+    m_frameId += 1;
   }
 
 
@@ -6691,6 +6852,17 @@ namespace dxvk {
 
 
   void D3D9DeviceEx::PrepareDraw(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBO) {
+    m_preparedDraws.fetch_add(1, std::memory_order_relaxed);
+
+    D3D9DrawStateKey drawKey = GetDrawStateKey(PrimitiveType, UploadVBOs, UploadIBO);
+
+    if (drawKey.valid && drawKey == m_lastDrawKey && CanUseFastDrawPath(drawKey)) {
+      PrepareDrawFast();
+      return;
+    }
+
+    m_lastDrawKey = drawKey;
+
     if (unlikely(m_activeHazardsRT != 0 || m_activeHazardsDS != 0))
       MarkRenderHazards();
 
@@ -6868,6 +7040,99 @@ namespace dxvk {
   }
 
 
+  D3D9DrawStateKey D3D9DeviceEx::GetDrawStateKey(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBO) {
+    D3D9DrawStateKey key;
+
+    // Fixed-function shaders and point rendering depend on too
+    // much state that isn't tracked precisely, so skip those
+    key.valid = PrimitiveType != D3DPT_POINTLIST
+      && UseProgrammableVS()
+      && UseProgrammablePS();
+
+    if (!key.valid)
+      return key;
+
+    key.vertexShader    = m_state.vertexShader.ptr();
+    key.pixelShader     = m_state.pixelShader.ptr();
+    key.vertexDecl      = m_state.vertexDecl.ptr();
+    key.epoch           = m_stateEpoch;
+    key.samplerMask     = m_psShaderMasks.samplerMask | m_vsShaderMasks.samplerMask;
+    key.activeTextures  = m_activeTextures;
+    key.textureTypes    = m_textureTypes;
+    key.projections     = m_projectionBitfield;
+    key.fetch4          = m_fetch4;
+    key.depthTextures   = m_depthTextures;
+    key.drefClamp       = m_drefClamp;
+    key.uploadVBOs      = UploadVBOs;
+    key.uploadIBO       = UploadIBO;
+    return key;
+  }
+
+
+  bool D3D9DeviceEx::CanUseFastDrawPath(const D3D9DrawStateKey& Key) {
+    if (m_activeHazardsRT || m_activeHazardsDS || m_lastHazardsRT || m_lastHazardsDS)
+      return false;
+
+    const uint32_t usedTextureMask = Key.activeTextures & Key.samplerMask;
+
+    if ((m_activeTexturesToUpload | m_activeTexturesToGen | m_dirtySamplerStates) & usedTextureMask)
+      return false;
+
+    if (m_dirtyTextures & Key.samplerMask)
+      return false;
+
+    // Fog and specialization constants are handled by the fast path,
+    // and fixed-function or point state is irrelevant for these draws
+    if (m_flags.any(
+        D3D9DeviceFlag::DirtyFramebuffer,
+        D3D9DeviceFlag::DirtyClipPlanes,
+        D3D9DeviceFlag::DirtyDepthStencilState,
+        D3D9DeviceFlag::DirtyBlendState,
+        D3D9DeviceFlag::DirtyRasterizerState,
+        D3D9DeviceFlag::DirtyDepthBias,
+        D3D9DeviceFlag::DirtyAlphaTestState,
+        D3D9DeviceFlag::DirtyInputLayout,
+        D3D9DeviceFlag::DirtyViewportScissor,
+        D3D9DeviceFlag::DirtyMultiSampleState,
+        D3D9DeviceFlag::DirtyProgVertexShader,
+        D3D9DeviceFlag::DirtySharedPixelShaderData,
+        D3D9DeviceFlag::DirtyDepthBounds))
+      return false;
+
+    if (Key.uploadVBOs && m_flags.test(D3D9DeviceFlag::DirtyVertexBuffers))
+      return false;
+
+    if (Key.uploadIBO && m_flags.test(D3D9DeviceFlag::DirtyIndexBuffer))
+      return false;
+
+    return true;
+  }
+
+
+  void D3D9DeviceEx::PrepareDrawFast() {
+    m_fastPathDraws.fetch_add(1, std::memory_order_relaxed);
+
+    UpdateFog();
+
+    UploadConstants<DxsoProgramTypes::VertexShader>();
+
+    if (likely(!CanSWVP())) {
+      UpdateVertexBoolSpec(
+        m_state.vsConsts->bConsts[0] &
+        m_consts[DxsoProgramType::VertexShader].meta.boolConstantMask);
+    } else
+      UpdateVertexBoolSpec(0);
+
+    UploadConstants<DxsoProgramTypes::PixelShader>();
+
+    UpdatePixelBoolSpec(
+      m_state.psConsts->bConsts[0] &
+      m_consts[DxsoProgramType::PixelShader].meta.boolConstantMask);
+
+    BindSpecConstants();
+  }
+
+
   template <DxsoProgramType ShaderStage>
   void D3D9DeviceEx::BindShader(
   const D3D9CommonShader*                 pShaderModule) {
@@ -7029,8 +7294,11 @@ namespace dxvk {
   void D3D9DeviceEx::Begin(D3D9Query* pQuery) {
     D3D9DeviceLock lock = LockDevice();
 
-    EmitCs([cQuery = Com<D3D9Query, false>(pQuery)](DxvkContext* ctx) {
-      cQuery->Begin(ctx);
+    EmitCs([
+      cQuery      = Com<D3D9Query, false>(pQuery),
+      cQuerySlot  = pQuery->GetQuerySlot()
+    ] (DxvkContext* ctx) {
+      cQuery->Begin(ctx, cQuerySlot);
     });
   }
 
@@ -7038,11 +7306,14 @@ namespace dxvk {
   void D3D9DeviceEx::End(D3D9Query* pQuery) {
     D3D9DeviceLock lock = LockDevice();
 
-    EmitCs([cQuery = Com<D3D9Query, false>(pQuery)](DxvkContext* ctx) {
-      cQuery->End(ctx);
+    EmitCs([
+      cQuery      = Com<D3D9Query, false>(pQuery),
+      cQuerySlot  = pQuery->GetQuerySlot()
+    ] (DxvkContext* ctx) {
+      cQuery->End(ctx, cQuerySlot);
     });
 
-    pQuery->NotifyEnd();
+    pQuery->NotifyEnd(GetCurrentSequenceNumber());
     if (unlikely(pQuery->IsEvent())) {
       pQuery->IsStalling()
         ? Flush()
@@ -7138,7 +7409,13 @@ namespace dxvk {
         ? m_consts[ProgramType].meta.maxConstIndexF
         : m_consts[ProgramType].meta.maxConstIndexI;
 
-      m_consts[ProgramType].dirty |= StartRegister < maxCount;
+      // Only consider registers that the current shader can read, and
+      // ignore redundant updates so that we don't upload the constant
+      // buffer again if the app sets the same values for every draw.
+      if (!m_consts[ProgramType].dirty && StartRegister < maxCount) {
+        m_consts[ProgramType].dirty = ShaderConstantsChanged<ProgramType, ConstantType>(
+          StartRegister, pConstantData, std::min(Count, maxCount - StartRegister));
+      }
     } else if constexpr (ProgramType == DxsoProgramType::VertexShader) {
       if (unlikely(CanSWVP())) {
         m_consts[DxsoProgramType::VertexShader].dirty |= StartRegister < m_consts[ProgramType].meta.maxConstIndexB;
@@ -7156,6 +7433,38 @@ namespace dxvk {
   }
 
 
+  template <
+    DxsoProgramType  ProgramType,
+    D3D9ConstantType ConstantType,
+    typename         T>
+    bool D3D9DeviceEx::ShaderConstantsChanged(
+            UINT  StartRegister,
+      const T*    pConstantData,
+            UINT  Count) {
+    auto CompareHelper = [&] (const auto& set) {
+      if constexpr (ConstantType == D3D9ConstantType::Float) {
+        if (m_d3d9Options.d3d9FloatEmulation != D3D9FloatEmulation::Enabled)
+          return std::memcmp(set->fConsts[StartRegister].data, pConstantData, Count * sizeof(Vector4)) != 0;
+
+        for (UINT i = 0; i < Count; i++) {
+          Vector4 value = replaceNaN(pConstantData + (i * 4));
+
+          if (std::memcmp(set->fConsts[StartRegister + i].data, value.data, sizeof(value)))
+            return true;
+        }
+
+        return false;
+      } else {
+        return std::memcmp(set->iConsts[StartRegister].data, pConstantData, Count * sizeof(Vector4i)) != 0;
+      }
+    };
+
+    return ProgramType == DxsoProgramTypes::VertexShader
+      ? CompareHelper(m_state.vsConsts)
+      : CompareHelper(m_state.psConsts);
+  }
+
+
   void D3D9DeviceEx::UpdateFixedFunctionVS() {
     // Shader...
     bool hasPositionT = m_state.vertexDecl != nullptr ? m_state.vertexDecl->TestFlag(D3D9VertexDeclFlag::HasPositionT) : false;
@@ -7587,6 +7896,8 @@ namespace dxvk {
 
 
   void D3D9DeviceEx::ResetState(D3DPRESENT_PARAMETERS* pPresentationParameters) {
+    m_lastDrawKey = D3D9DrawStateKey();
+
     SetDepthStencilSurface(nullptr);
 
     for (uint32_t i = 0; i < caps::MaxSimultaneousRenderTargets; i++)
@@ -7939,7 +8250,8 @@ namespace dxvk {
     // We do not flush empty chunks, so if we are tracking a resource
     // immediately after a flush, we need to use the sequence number
     // of the previously submitted chunk to prevent deadlocks.
-    return m_csChunk->empty() ? m_csSeqNum : m_csSeqNum + 1;
+    // A pending UP draw will be recorded into the current chunk.
+    return m_csChunk->empty() && !m_upDraw.vertexCount ? m_csSeqNum : m_csSeqNum + 1;
   }
 
 
@@ -7999,6 +8311,61 @@ namespace dxvk {
 #endif
   }
 
+  void D3D9DeviceEx::TouchColdTexture(D3D9CommonTexture* pTexture) {
+    // Will only be called inside the device lock
+    if (likely(!m_d3d9Options.coldTextureTimeout))
+      return;
+
+    pTexture->SetLastAccess(dxvk::high_resolution_clock::now());
+    m_coldCandidates.insert(pTexture);
+  }
+
+  void D3D9DeviceEx::RemoveColdTexture(D3D9CommonTexture* pTexture) {
+    if (likely(!m_d3d9Options.coldTextureTimeout))
+      return;
+
+    D3D9DeviceLock lock = LockDevice();
+    m_coldCandidates.remove(pTexture);
+
+    for (size_t i = 0; i < m_coldPending.size(); i++) {
+      if (m_coldPending[i] == pTexture) {
+        m_coldPending[i] = m_coldPending.back();
+        m_coldPending.pop_back();
+        break;
+      }
+    }
+  }
+
+  void D3D9DeviceEx::ProcessColdTextures() {
+    // Will only be called inside the device lock
+    if (likely(!m_d3d9Options.coldTextureTimeout))
+      return;
+
+    // Replace mapping buffers with compressed data for all
+    // textures whose compression job has completed by now
+    for (size_t i = 0; i < m_coldPending.size(); ) {
+      if (m_coldPending[i]->FinishColdStorage()) {
+        m_coldPending[i] = m_coldPending.back();
+        m_coldPending.pop_back();
+      } else {
+        i++;
+      }
+    }
+
+    auto now = dxvk::high_resolution_clock::now();
+    auto timeout = std::chrono::seconds(m_d3d9Options.coldTextureTimeout);
+
+    // Textures that are locked again get moved to the end of the list,
+    // so we can stop at the first one that has been used recently.
+    auto iter = m_coldCandidates.leastRecentlyUsedIter();
+    while (iter != m_coldCandidates.leastRecentlyUsedEndIter() && (*iter)->GetLastAccess() + timeout <= now) {
+      if ((*iter)->StartColdStorage(m_coldStorage))
+        m_coldPending.push_back(*iter);
+
+      iter = m_coldCandidates.remove(iter);
+    }
+  }
+
   ////////////////////////////////////
   // D3D9 Device Lost
   ////////////////////////////////////
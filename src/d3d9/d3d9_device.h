@@ -11,6 +11,7 @@
 #include "d3d9_adapter.h"
 #include "d3d9_constant_buffer.h"
 #include "d3d9_constant_set.h"
+#include "d3d9_cold_storage.h"
 #include "d3d9_mem.h"
 
 #include "d3d9_state.h"
@@ -110,6 +111,62 @@ namespace dxvk {
     void*           mapPtr = nullptr;
   };
 
+  /**
+   * \brief Draw state key
+   *
+   * State that \c PrepareDraw derives bindings and specialization
+   * constants from, but which is not covered by dirty flags. If this
+   * matches the previous draw and no relevant dirty flags are set,
+   * only shader constants need to be updated.
+   */
+  struct D3D9DrawStateKey {
+    const void* vertexShader    = nullptr;
+    const void* pixelShader     = nullptr;
+    const void* vertexDecl      = nullptr;
+    uint64_t    epoch           = 0;
+    uint32_t    samplerMask     = 0;
+    uint32_t    activeTextures  = 0;
+    uint32_t    textureTypes    = 0;
+    uint32_t    projections     = 0;
+    uint32_t    fetch4          = 0;
+    uint32_t    depthTextures   = 0;
+    uint32_t    drefClamp       = 0;
+    bool        uploadVBOs      = false;
+    bool        uploadIBO       = false;
+    bool        valid           = false;
+
+    bool operator == (const D3D9DrawStateKey& other) const {
+      return vertexShader   == other.vertexShader
+          && pixelShader    == other.pixelShader
+          && vertexDecl     == other.vertexDecl
+          && epoch          == other.epoch
+          && samplerMask    == other.samplerMask
+          && activeTextures == other.activeTextures
+          && textureTypes   == other.textureTypes
+          && projections    == other.projections
+          && fetch4         == other.fetch4
+          && depthTextures  == other.depthTextures
+          && drefClamp      == other.drefClamp
+          && uploadVBOs     == other.uploadVBOs
+          && uploadIBO      == other.uploadIBO
+          && valid          == other.valid;
+    }
+  };
+
+  /**
+   * \brief Pending non-indexed UP draw
+   *
+   * Consecutive \c DrawPrimitiveUP calls with list topologies
+   * are merged into one draw as long as no other command gets
+   * recorded in between and the vertex data is contiguous.
+   */
+  struct D3D9UPDrawBatch {
+    DxvkBufferSlice   slice       = {};
+    D3DPRIMITIVETYPE  primType    = D3DPT_POINTLIST;
+    uint32_t          stride      = 0;
+    uint32_t          vertexCount = 0;
+  };
+
   struct D3D9StagingBufferMarkerPayload {
     uint64_t        sequenceNumber;
     VkDeviceSize    allocated;
@@ -129,6 +186,8 @@ namespace dxvk {
 
     constexpr static VkDeviceSize StagingBufferSize = 4ull << 20;
 
+    constexpr static VkDeviceSize UPBufferSize = 4ull << 20;
+
     friend class D3D9SwapChainEx;
     friend struct D3D9WindowContext;
     friend class D3D9ConstantBuffer;
@@ -918,6 +977,12 @@ namespace dxvk {
 
     void PrepareDraw(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBOs);
 
+    D3D9DrawStateKey GetDrawStateKey(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBO);
+
+    bool CanUseFastDrawPath(const D3D9DrawStateKey& Key);
+
+    void PrepareDrawFast();
+
     template <DxsoProgramType ShaderStage>
     void BindShader(
       const D3D9CommonShader*                 pShaderModule);
@@ -947,6 +1012,27 @@ namespace dxvk {
     void Begin(D3D9Query* pQuery);
     void End(D3D9Query* pQuery);
 
+    /**
+     * \brief Checks whether commands were submitted
+     *
+     * \param [in] SequenceNumber CS chunk sequence number
+     * \returns \c true if all commands up to and including
+     *    the given chunk have been flushed to the GPU.
+     */
+    bool IsFlushed(uint64_t SequenceNumber) const {
+      return SequenceNumber <= m_flushSeqNum;
+    }
+
+    /**
+     * \brief Current frame number
+     *
+     * Incremented every time a frame is presented.
+     * \returns Number of frames presented so far
+     */
+    uint64_t GetFrameId() const {
+      return m_frameId;
+    }
+
     void SetVertexBoolBitfield(uint32_t idx, uint32_t mask, uint32_t bits);
     void SetPixelBoolBitfield (uint32_t idx, uint32_t mask, uint32_t bits);
 
@@ -979,6 +1065,18 @@ namespace dxvk {
 
     HRESULT InitialReset(D3DPRESENT_PARAMETERS* pPresentationParameters, D3DDISPLAYMODEEX* pFullscreenDisplayMode);
 
+    uint64_t GetUploadedConstantCount() const {
+      return m_uploadedConstants.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetPreparedDrawCount() const {
+      return m_preparedDraws.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GetFastPathDrawCount() const {
+      return m_fastPathDraws.load(std::memory_order_relaxed);
+    }
+
     UINT GetSamplerCount() const {
       return m_samplerCount.load();
     }
@@ -991,6 +1089,13 @@ namespace dxvk {
     void TouchMappedTexture(D3D9CommonTexture* pTexture);
     void RemoveMappedTexture(D3D9CommonTexture* pTexture);
 
+    D3D9ColdStorage* GetColdStorage() {
+      return &m_coldStorage;
+    }
+
+    void TouchColdTexture(D3D9CommonTexture* pTexture);
+    void RemoveColdTexture(D3D9CommonTexture* pTexture);
+
     bool IsD3D8Compatible() const {
       return m_isD3D8Compatible;
     }
@@ -1031,6 +1136,9 @@ namespace dxvk {
 
     template<bool AllowFlush = true, typename Cmd>
     void EmitCs(Cmd&& command) {
+      if (unlikely(m_upDraw.vertexCount))
+        FlushUPDraw();
+
       if (unlikely(!m_csChunk->push(command))) {
         EmitCsChunk(std::move(m_csChunk));
         m_csChunk = AllocCsChunk();
@@ -1045,6 +1153,9 @@ namespace dxvk {
     void EmitCsChunk(DxvkCsChunkRef&& chunk);
 
     void FlushCsChunk() {
+      if (unlikely(m_upDraw.vertexCount))
+        FlushUPDraw();
+
       if (likely(!m_csChunk->empty())) {
         EmitCsChunk(std::move(m_csChunk));
         m_csChunk = AllocCsChunk();
@@ -1067,6 +1178,14 @@ namespace dxvk {
 
     D3D9BufferSlice AllocUPBuffer(VkDeviceSize size);
 
+    bool TryMergeUPDraw(
+            D3DPRIMITIVETYPE  PrimitiveType,
+            uint32_t          VertexCount,
+      const void*             pVertexData,
+            uint32_t          Stride);
+
+    void FlushUPDraw();
+
     D3D9BufferSlice AllocStagingBuffer(VkDeviceSize size);
 
     void EmitStagingBufferMarker();
@@ -1149,6 +1268,15 @@ namespace dxvk {
         const T*    pConstantData,
               UINT  Count);
 
+    template <
+      DxsoProgramType  ProgramType,
+      D3D9ConstantType ConstantType,
+      typename         T>
+      bool ShaderConstantsChanged(
+              UINT  StartRegister,
+        const T*    pConstantData,
+              UINT  Count);
+
     template <
       DxsoProgramType  ProgramType,
       D3D9ConstantType ConstantType,
@@ -1243,6 +1371,8 @@ namespace dxvk {
 
     void UnmapTextures();
 
+    void ProcessColdTextures();
+
     uint64_t GetCurrentSequenceNumber();
 
     /**
@@ -1288,10 +1418,17 @@ namespace dxvk {
     // into the same chunks as texture memory would waste address space.
     D3D9MemoryAllocator             m_shaderAllocator;
 
+    // Compressed system memory copies of textures that
+    // have not been locked in a while, if enabled.
+    D3D9ColdStorage                 m_coldStorage;
+    lru_list<D3D9CommonTexture*>    m_coldCandidates;
+    std::vector<D3D9CommonTexture*> m_coldPending;
+
     uint32_t                        m_frameLatency = DefaultFrameLatency;
 
     D3D9Initializer*                m_initializer = nullptr;
     D3D9FormatHelper*               m_converter   = nullptr;
+    uint64_t                        m_converterSeqNum = 0ull;
 
     D3D9FFShaderModuleSet           m_ffModules;
     D3D9SWVPEmulator                m_swvpEmulator;
@@ -1311,6 +1448,7 @@ namespace dxvk {
     Rc<DxvkBuffer>                  m_upBuffer;
     VkDeviceSize                    m_upBufferOffset  = 0ull;
     void*                           m_upBufferMapPtr  = nullptr;
+    D3D9UPDrawBatch                 m_upDraw;
 
     DxvkStagingBuffer               m_stagingBuffer;
     VkDeviceSize                    m_stagingBufferAllocated      = 0ull;
@@ -1342,6 +1480,11 @@ namespace dxvk {
     D3D9InputAssemblyState          m_iaState;
 
     D3D9DeviceFlags                 m_flags;
+
+    // Incremented whenever state that PrepareDraw depends
+    // on changes without setting any of the dirty flags
+    uint64_t                        m_stateEpoch = 0;
+    D3D9DrawStateKey                m_lastDrawKey;
     // Last state of depth textures. Doesn't update when NULL is bound.
     // & with m_activeTextures to normalize.
     uint32_t                        m_instancedData = 0;
@@ -1430,8 +1573,13 @@ namespace dxvk {
     uint64_t                        m_flushSeqNum = 0ull;
     GpuFlushTracker                 m_flushTracker;
 
+    uint64_t                        m_frameId = 0ull;
+
     std::atomic<int64_t>            m_availableMemory = { 0 };
     std::atomic<int32_t>            m_samplerCount    = { 0 };
+    std::atomic<uint64_t>           m_uploadedConstants = { 0 };
+    std::atomic<uint64_t>           m_preparedDraws     = { 0 };
+    std::atomic<uint64_t>           m_fastPathDraws     = { 0 };
 
     D3D9DeviceLostState             m_deviceLostState          = D3D9DeviceLostState::Ok;
     HWND                            m_fullscreenWindow         = NULL;
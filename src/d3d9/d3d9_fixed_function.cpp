@@ -336,12 +336,13 @@ namespace dxvk {
   }
 
 
-  uint32_t SetupRenderStateBlock(SpirvModule& spvModule) {
+  uint32_t SetupRenderStateBlock(SpirvModule& spvModule, bool floatConstants) {
     uint32_t floatType = spvModule.defFloatType(32);
     uint32_t uintType  = spvModule.defIntType(32, 0);
     uint32_t vec3Type  = spvModule.defVectorType(floatType, 3);
+    uint32_t vec4Type  = spvModule.defVectorType(floatType, 4);
 
-    std::array<uint32_t, 11> rsMembers = {{
+    std::vector<uint32_t> rsMembers = {
       vec3Type,
       floatType,
       floatType,
@@ -355,7 +356,16 @@ namespace dxvk {
       floatType,
       floatType,
       floatType,
-    }};
+    };
+
+    // Float constants are stored after the last render state member
+    if (floatConstants) {
+      uint32_t arrayType = spvModule.defArrayTypeUnique(vec4Type,
+        spvModule.constu32(D3D9PushConstantFloatCount));
+      spvModule.decorateArrayStride(arrayType, sizeof(Vector4));
+
+      rsMembers.push_back(arrayType);
+    }
 
     uint32_t rsStruct = spvModule.defStructTypeUnique(rsMembers.size(), rsMembers.data());
     uint32_t rsBlock = spvModule.newVar(
@@ -386,6 +396,9 @@ namespace dxvk {
     SetMemberName("point_scale_b",  offsetof(D3D9RenderStateInfo, pointScaleB));
     SetMemberName("point_scale_c",  offsetof(D3D9RenderStateInfo, pointScaleC));
 
+    if (floatConstants)
+      SetMemberName("f",            D3D9PushConstantFloatOffset);
+
     return rsBlock;
   }
 
@@ -888,7 +901,7 @@ namespace dxvk {
     info.outputMask = m_outputMask;
     info.flatShadingInputs = m_flatShadingMask;
     info.pushConstStages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    info.pushConstSize = sizeof(D3D9RenderStateInfo);
+    info.pushConstSize = D3D9PushConstantSize;
 
     return new DxvkShader(info, m_module.compile());
   }
@@ -1,5 +1,7 @@
 #include "d3d9_format_helpers.h"
 
+#include <algorithm>
+
 #include <d3d9_convert_yuy2_uyvy.h>
 #include <d3d9_convert_l6v5u5.h>
 #include <d3d9_convert_x8l8v8u8.h>
@@ -20,7 +22,7 @@ namespace dxvk {
 
 
   void D3D9FormatHelper::Flush() {
-    if (m_transferCommands != 0)
+    if (!m_jobs.empty())
       FlushInternal();
   }
 
@@ -30,85 +32,82 @@ namespace dxvk {
     const Rc<DxvkImage>&                dstImage,
           VkImageSubresourceLayers      dstSubresource,
     const DxvkBufferSlice&              srcSlice) {
-    switch (conversionFormat.FormatType) {
+    if (unlikely(conversionFormat.FormatType >= D3D9ConversionFormat_Count
+              || m_shaders[conversionFormat.FormatType] == nullptr)) {
+      Logger::warn("Unimplemented format conversion");
+      return;
+    }
+
+    // Conversions are only recorded on flush so that all
+    // jobs of the same format can share pipeline state
+    D3D9ConversionJob& job = m_jobs.emplace_back();
+    job.format          = conversionFormat;
+    job.dstImage        = dstImage;
+    job.dstSubresource  = dstSubresource;
+    job.srcSlice        = srcSlice;
+  }
+
+
+  D3D9FormatHelper::ConversionParams D3D9FormatHelper::GetConversionParams(
+          D3D9ConversionFormat          formatType) {
+    switch (formatType) {
       case D3D9ConversionFormat_YUY2:
-      case D3D9ConversionFormat_UYVY: {
-        uint32_t specConstant = conversionFormat.FormatType == D3D9ConversionFormat_UYVY ? 1 : 0;
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R32_UINT, specConstant, { 2u, 1u });
-        break;
-      }
+        return { VK_FORMAT_R32_UINT, 0, { 2u, 1u } };
+
+      case D3D9ConversionFormat_UYVY:
+        return { VK_FORMAT_R32_UINT, 1, { 2u, 1u } };
 
       case D3D9ConversionFormat_NV12:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R16_UINT, 0, { 2u, 1u });
-        break;
+        return { VK_FORMAT_R16_UINT, 0, { 2u, 1u } };
 
       case D3D9ConversionFormat_YV12:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R8_UINT, 0, { 1u, 1u });
-        break;
+        return { VK_FORMAT_R8_UINT, 0, { 1u, 1u } };
 
       case D3D9ConversionFormat_L6V5U5:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R16_UINT, 0, { 1u, 1u });
-        break;
+        return { VK_FORMAT_R16_UINT, 0, { 1u, 1u } };
 
       case D3D9ConversionFormat_X8L8V8U8:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R32_UINT, 0, { 1u, 1u });
-        break;
-
       case D3D9ConversionFormat_A2W10V10U10:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R32_UINT, 0, { 1u, 1u });
-        break;
-
       case D3D9ConversionFormat_W11V11U10:
-        ConvertGenericFormat(conversionFormat, dstImage, dstSubresource, srcSlice, VK_FORMAT_R32_UINT, 0, { 1u, 1u });
-        break;
-
       default:
-        Logger::warn("Unimplemented format conversion");
+        return { VK_FORMAT_R32_UINT, 0, { 1u, 1u } };
     }
   }
 
 
   void D3D9FormatHelper::ConvertGenericFormat(
-          D3D9_CONVERSION_FORMAT_INFO   videoFormat,
-    const Rc<DxvkImage>&                dstImage,
-          VkImageSubresourceLayers      dstSubresource,
-    const DxvkBufferSlice&              srcSlice,
+    const D3D9ConversionJob&            job,
           VkFormat                      bufferFormat,
-          uint32_t                      specConstantValue,
           VkExtent2D                    macroPixelRun) {
     DxvkImageViewCreateInfo imageViewInfo;
     imageViewInfo.type      = VK_IMAGE_VIEW_TYPE_2D;
-    imageViewInfo.format    = dstImage->info().format;
+    imageViewInfo.format    = job.dstImage->info().format;
     imageViewInfo.usage     = VK_IMAGE_USAGE_STORAGE_BIT;
-    imageViewInfo.aspect    = dstSubresource.aspectMask;
-    imageViewInfo.minLevel  = dstSubresource.mipLevel;
+    imageViewInfo.aspect    = job.dstSubresource.aspectMask;
+    imageViewInfo.minLevel  = job.dstSubresource.mipLevel;
     imageViewInfo.numLevels = 1;
-    imageViewInfo.minLayer  = dstSubresource.baseArrayLayer;
-    imageViewInfo.numLayers = dstSubresource.layerCount;
-    auto tmpImageView = m_device->createImageView(dstImage, imageViewInfo);
+    imageViewInfo.minLayer  = job.dstSubresource.baseArrayLayer;
+    imageViewInfo.numLayers = job.dstSubresource.layerCount;
+    auto tmpImageView = m_device->createImageView(job.dstImage, imageViewInfo);
 
-    VkExtent3D imageExtent = dstImage->mipLevelExtent(dstSubresource.mipLevel);
+    VkExtent3D imageExtent = job.dstImage->mipLevelExtent(job.dstSubresource.mipLevel);
     imageExtent = VkExtent3D{ imageExtent.width  / macroPixelRun.width,
                               imageExtent.height / macroPixelRun.height,
                               1 };
 
     DxvkBufferViewCreateInfo bufferViewInfo;
     bufferViewInfo.format      = bufferFormat;
-    bufferViewInfo.rangeOffset = srcSlice.offset();
-    bufferViewInfo.rangeLength = srcSlice.length();
-    auto tmpBufferView = m_device->createBufferView(srcSlice.buffer(), bufferViewInfo);
+    bufferViewInfo.rangeOffset = job.srcSlice.offset();
+    bufferViewInfo.rangeLength = job.srcSlice.length();
+    auto tmpBufferView = m_device->createBufferView(job.srcSlice.buffer(), bufferViewInfo);
 
-    m_context->setSpecConstant(VK_PIPELINE_BIND_POINT_COMPUTE, 0, specConstantValue);
     m_context->bindResourceImageView(VK_SHADER_STAGE_COMPUTE_BIT, BindingIds::Image, std::move(tmpImageView));
     m_context->bindResourceBufferView(VK_SHADER_STAGE_COMPUTE_BIT, BindingIds::Buffer, std::move(tmpBufferView));
-    m_context->bindShader<VK_SHADER_STAGE_COMPUTE_BIT>(Rc<DxvkShader>(m_shaders[videoFormat.FormatType]));
     m_context->pushConstants(0, sizeof(VkExtent2D), &imageExtent);
     m_context->dispatch(
       (imageExtent.width  / 8) + (imageExtent.width  % 8),
       (imageExtent.height / 8) + (imageExtent.height % 8),
       1);
-
-    m_transferCommands += 1;
   }
 
 
@@ -142,9 +141,34 @@ namespace dxvk {
 
 
   void D3D9FormatHelper::FlushInternal() {
+    // Group jobs by format so that the pipeline only needs to be
+    // bound once per format. Sorting is stable, so conversions
+    // into the same subresource are still executed in order.
+    std::stable_sort(m_jobs.begin(), m_jobs.end(),
+      [] (const D3D9ConversionJob& a, const D3D9ConversionJob& b) {
+        return a.format.FormatType < b.format.FormatType;
+      });
+
+    D3D9ConversionFormat boundFormat = D3D9ConversionFormat_None;
+
+    for (const auto& job : m_jobs) {
+      ConversionParams params = GetConversionParams(job.format.FormatType);
+
+      if (job.format.FormatType != boundFormat) {
+        m_context->setSpecConstant(VK_PIPELINE_BIND_POINT_COMPUTE, 0, params.specConstantValue);
+        m_context->bindShader<VK_SHADER_STAGE_COMPUTE_BIT>(Rc<DxvkShader>(m_shaders[job.format.FormatType]));
+
+        boundFormat = job.format.FormatType;
+      }
+
+      ConvertGenericFormat(job, params.bufferFormat, params.macroPixelRun);
+    }
+
+    m_context->addStatCtr(DxvkStatCounter::CmdConversionCount, m_jobs.size());
+    m_context->addStatCtr(DxvkStatCounter::CmdConversionBatchCount, 1);
     m_context->flushCommandList(nullptr);
-    
-    m_transferCommands = 0;
+
+    m_jobs.clear();
   }
 
 }
\ No newline at end of file
@@ -7,6 +7,16 @@
 
 namespace dxvk {
 
+  /**
+   * \brief Pending format conversion
+   */
+  struct D3D9ConversionJob {
+    D3D9_CONVERSION_FORMAT_INFO   format;
+    Rc<DxvkImage>                 dstImage;
+    VkImageSubresourceLayers      dstSubresource;
+    DxvkBufferSlice               srcSlice;
+  };
+
   class D3D9FormatHelper {
 
   public:
@@ -23,13 +33,18 @@ namespace dxvk {
 
   private:
 
+    struct ConversionParams {
+      VkFormat                      bufferFormat;
+      uint32_t                      specConstantValue;
+      VkExtent2D                    macroPixelRun;
+    };
+
+    static ConversionParams GetConversionParams(
+            D3D9ConversionFormat          formatType);
+
     void ConvertGenericFormat(
-            D3D9_CONVERSION_FORMAT_INFO   videoFormat,
-      const Rc<DxvkImage>&                dstImage,
-            VkImageSubresourceLayers      dstSubresource,
-      const DxvkBufferSlice&              srcSlice,
+      const D3D9ConversionJob&            job,
             VkFormat                      bufferFormat,
-            uint32_t                      specConstantValue,
             VkExtent2D                    macroPixelRun);
 
     enum BindingIds : uint32_t {
@@ -46,7 +61,7 @@ namespace dxvk {
     Rc<DxvkDevice>    m_device;
     Rc<DxvkContext>   m_context;
 
-    size_t            m_transferCommands = 0;
+    std::vector<D3D9ConversionJob> m_jobs;
 
     std::array<Rc<DxvkShader>, D3D9ConversionFormat_Count> m_shaders;
 
@@ -92,4 +92,129 @@ namespace dxvk::hud {
     return position;
   }
 
+
+
+  HudConstantUploads::HudConstantUploads(D3D9DeviceEx* device)
+    : m_device          (device)
+    , m_constantString  ("0") { }
+
+
+  void HudConstantUploads::update(dxvk::high_resolution_clock::time_point time) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(time - m_lastUpdate);
+
+    if (elapsed.count() < UpdateInterval)
+      return;
+
+    uint64_t currConstants = m_device->GetUploadedConstantCount();
+    uint64_t currDraws = m_device->GetDXVKDevice()->getStatCounters().getCtr(DxvkStatCounter::CmdDrawCalls);
+
+    uint64_t diffConstants = currConstants - m_prevConstants;
+    uint64_t diffDraws = currDraws - m_prevDraws;
+
+    m_constantString = str::format(diffDraws ? diffConstants / diffDraws : 0u, " per draw");
+
+    m_prevConstants = currConstants;
+    m_prevDraws = currDraws;
+    m_lastUpdate = time;
+  }
+
+
+  HudPos HudConstantUploads::render(
+          HudRenderer&      renderer,
+          HudPos            position) {
+    position.y += 16.0f;
+
+    renderer.drawText(16.0f,
+      { position.x, position.y },
+      { 0.0f, 1.0f, 0.75f, 1.0f },
+      "Constants:");
+
+    renderer.drawText(16.0f,
+      { position.x + 120.0f, position.y },
+      { 1.0f, 1.0f, 1.0f, 1.0f },
+      m_constantString);
+
+    position.y += 8.0f;
+    return position;
+  }
+
+
+
+  HudFastDraws::HudFastDraws(D3D9DeviceEx* device)
+    : m_device          (device)
+    , m_fastDrawString  ("0%") { }
+
+
+  void HudFastDraws::update(dxvk::high_resolution_clock::time_point time) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(time - m_lastUpdate);
+
+    if (elapsed.count() < UpdateInterval)
+      return;
+
+    uint64_t currDraws = m_device->GetPreparedDrawCount();
+    uint64_t currFastDraws = m_device->GetFastPathDrawCount();
+
+    uint64_t diffDraws = currDraws - m_prevDraws;
+    uint64_t diffFastDraws = currFastDraws - m_prevFastDraws;
+
+    m_fastDrawString = str::format(diffDraws ? (100u * diffFastDraws) / diffDraws : 0u, "% of ", diffDraws, " draws");
+
+    m_prevDraws = currDraws;
+    m_prevFastDraws = currFastDraws;
+    m_lastUpdate = time;
+  }
+
+
+  HudPos HudFastDraws::render(
+          HudRenderer&      renderer,
+          HudPos            position) {
+    position.y += 16.0f;
+
+    renderer.drawText(16.0f,
+      { position.x, position.y },
+      { 0.0f, 1.0f, 0.75f, 1.0f },
+      "Fast draws:");
+
+    renderer.drawText(16.0f,
+      { position.x + 120.0f, position.y },
+      { 1.0f, 1.0f, 1.0f, 1.0f },
+      m_fastDrawString);
+
+    position.y += 8.0f;
+    return position;
+  }
+
+
+
+  HudColdTextureMemory::HudColdTextureMemory(D3D9DeviceEx* device)
+    : m_device      (device)
+    , m_coldString  ("0 MB") { }
+
+
+  void HudColdTextureMemory::update(dxvk::high_resolution_clock::time_point time) {
+    D3D9ColdStorageStats stats = m_device->GetColdStorage()->GetStats();
+
+    m_coldString = str::format(stats.storedSize >> 20, " MB (Compressed: ", stats.compressedSize >> 20, " MB)");
+  }
+
+
+  HudPos HudColdTextureMemory::render(
+          HudRenderer&      renderer,
+          HudPos            position) {
+    position.y += 16.0f;
+
+    renderer.drawText(16.0f,
+      { position.x, position.y },
+      { 0.0f, 1.0f, 0.75f, 1.0f },
+      "Cold:");
+
+    renderer.drawText(16.0f,
+      { position.x + 120.0f, position.y },
+      { 1.0f, 1.0f, 1.0f, 1.0f },
+      m_coldString);
+
+    position.y += 8.0f;
+    return position;
+  }
+
 }
\ No newline at end of file
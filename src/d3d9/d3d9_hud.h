@@ -60,4 +60,93 @@ namespace dxvk::hud {
 
     };
 
+  /**
+   * \brief HUD item to display constant uploads
+   *
+   * Shows the average number of constant registers
+   * that get copied to constant buffers per draw.
+   */
+  class HudConstantUploads : public HudItem {
+    constexpr static int64_t UpdateInterval = 500'000;
+
+  public:
+
+    HudConstantUploads(D3D9DeviceEx* device);
+
+    void update(dxvk::high_resolution_clock::time_point time);
+
+    HudPos render(
+            HudRenderer&      renderer,
+            HudPos            position);
+
+  private:
+
+    D3D9DeviceEx* m_device;
+
+    uint64_t m_prevConstants = 0;
+    uint64_t m_prevDraws     = 0;
+
+    dxvk::high_resolution_clock::time_point m_lastUpdate
+      = dxvk::high_resolution_clock::now();
+
+    std::string m_constantString;
+
+  };
+
+  /**
+   * \brief HUD item to display draw validation fast path hits
+   *
+   * Shows the percentage of draws that only had to
+   * update shader constants before being recorded.
+   */
+  class HudFastDraws : public HudItem {
+    constexpr static int64_t UpdateInterval = 500'000;
+
+  public:
+
+    HudFastDraws(D3D9DeviceEx* device);
+
+    void update(dxvk::high_resolution_clock::time_point time);
+
+    HudPos render(
+            HudRenderer&      renderer,
+            HudPos            position);
+
+  private:
+
+    D3D9DeviceEx* m_device;
+
+    uint64_t m_prevDraws     = 0;
+    uint64_t m_prevFastDraws = 0;
+
+    dxvk::high_resolution_clock::time_point m_lastUpdate
+      = dxvk::high_resolution_clock::now();
+
+    std::string m_fastDrawString;
+
+  };
+
+  /**
+   * \brief HUD item to display compressed texture memory
+   */
+  class HudColdTextureMemory : public HudItem {
+
+  public:
+
+    HudColdTextureMemory(D3D9DeviceEx* device);
+
+    void update(dxvk::high_resolution_clock::time_point time);
+
+    HudPos render(
+            HudRenderer&      renderer,
+            HudPos            position);
+
+  private:
+
+    D3D9DeviceEx* m_device;
+
+    std::string m_coldString;
+
+  };
+
 }
\ No newline at end of file
@@ -6,8 +6,15 @@
 #include <utility>
 
 #ifdef D3D9_ALLOW_UNMAPPING
+#ifdef _WIN32
 #include <sysinfoapi.h>
 #else
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#else
 #include <stdlib.h>
 #endif
 
@@ -15,9 +22,13 @@ namespace dxvk {
 
 #ifdef D3D9_ALLOW_UNMAPPING
   D3D9MemoryAllocator::D3D9MemoryAllocator() {
+#ifdef _WIN32
     SYSTEM_INFO sysInfo;
     GetSystemInfo(&sysInfo);
     m_allocationGranularity = sysInfo.dwAllocationGranularity;
+#else
+    m_allocationGranularity = uint32_t(sysconf(_SC_PAGESIZE));
+#endif
   }
 
   D3D9Memory D3D9MemoryAllocator::Alloc(uint32_t Size) {
@@ -49,6 +60,10 @@ namespace dxvk {
 
     m_allocatedMemory -= Chunk->Size();
 
+    // Mappings of the chunk may still be cached
+    Chunk->UnmapIdleRanges();
+    m_idleChunks.remove(Chunk);
+
     m_chunks.erase(std::remove_if(m_chunks.begin(), m_chunks.end(), [&](auto& item) {
         return item.get() == Chunk;
     }), m_chunks.end());
@@ -62,12 +77,51 @@ namespace dxvk {
     m_mappedMemory -= Size;
   }
 
+  void D3D9MemoryAllocator::NotifyIdle(uint32_t Size) {
+    m_idleMappedMemory += Size;
+  }
+
+  void D3D9MemoryAllocator::NotifyReused(uint32_t Size) {
+    m_idleMappedMemory -= Size;
+  }
+
+  void D3D9MemoryAllocator::TrackIdleChunk(D3D9MemoryChunk* Chunk) {
+    std::lock_guard<dxvk::mutex> lock(m_mutex);
+
+    m_idleChunks.insert(Chunk);
+
+    if (unlikely(m_idleMappedMemory > D3D9IdleMappingBudget))
+      UnmapColdChunks();
+  }
+
   void D3D9MemoryAllocator::NotifyFreed(uint32_t Size) {
     m_usedMemory -= Size;
   }
 
+  void D3D9MemoryAllocator::UnmapColdChunks() {
+    // Will only be called with the allocator lock held. Unmap
+    // a bit more than necessary so that we don't end up doing
+    // this every single time a mapping becomes idle.
+    uint32_t threshold = (D3D9IdleMappingBudget / 4) * 3;
+
+    auto iter = m_idleChunks.leastRecentlyUsedIter();
+    while (m_idleMappedMemory > threshold && iter != m_idleChunks.leastRecentlyUsedEndIter()) {
+      (*iter)->UnmapIdleRanges();
+      iter = m_idleChunks.remove(iter);
+    }
+  }
+
   uint32_t D3D9MemoryAllocator::MappedMemory() {
-    return m_mappedMemory.load();
+    // Idle mappings are bounded by their own budget and get
+    // unmapped by the allocator, so don't let them count
+    // towards the mapped texture memory limit.
+    size_t mapped = m_mappedMemory.load();
+    size_t idle = m_idleMappedMemory.load();
+    return mapped > idle ? mapped - idle : 0;
+  }
+
+  uint32_t D3D9MemoryAllocator::IdleMappedMemory() {
+    return m_idleMappedMemory.load();
   }
 
   uint32_t D3D9MemoryAllocator::UsedMemory() {
@@ -80,7 +134,14 @@ namespace dxvk {
 
   D3D9MemoryChunk::D3D9MemoryChunk(D3D9MemoryAllocator* Allocator, uint32_t Size)
     : m_allocator(Allocator), m_size(Size), m_mappingGranularity(m_allocator->MemoryGranularity() * 16) {
+#ifdef _WIN32
     m_mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE | SEC_COMMIT, 0, Size, nullptr);
+#else
+    m_fd = memfd_create("d3d9_memory", MFD_CLOEXEC);
+
+    if (unlikely(m_fd < 0 || ftruncate(m_fd, Size) != 0))
+      Logger::err(str::format("Creating memory file failed: ", strerror(errno), ", Size: ", Size));
+#endif
     m_freeRanges.push_back({ 0, Size });
     m_mappingRanges.resize(((Size + m_mappingGranularity - 1) / m_mappingGranularity));
   }
@@ -88,7 +149,45 @@ namespace dxvk {
   D3D9MemoryChunk::~D3D9MemoryChunk() {
     std::lock_guard<dxvk::mutex> lock(m_mutex);
 
+#ifdef _WIN32
     CloseHandle(m_mapping);
+#else
+    if (m_fd >= 0)
+      close(m_fd);
+#endif
+  }
+
+  void* D3D9MemoryChunk::MapRange(uint32_t Offset, uint32_t Size) {
+#ifdef _WIN32
+    void* ptr = MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, Offset, Size);
+    if (unlikely(ptr == nullptr)) {
+      DWORD error = GetLastError();
+      LPTSTR buffer = nullptr;
+      FormatMessage(FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM, nullptr, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL), (LPTSTR)&buffer, 0, nullptr);
+      Logger::err(str::format("Mapping non-persisted file failed: ", error, ", Mapped memory: ", m_allocator->MappedMemory(), ", Msg: ", buffer));
+      if (buffer) {
+        LocalFree(buffer);
+      }
+      return nullptr;
+    }
+#else
+    void* ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, off_t(Offset));
+    if (unlikely(ptr == MAP_FAILED)) {
+      Logger::err(str::format("Mapping memory file failed: ", strerror(errno), ", Mapped memory: ", m_allocator->MappedMemory()));
+      return nullptr;
+    }
+#endif
+    m_allocator->NotifyMapped(Size);
+    return ptr;
+  }
+
+  void D3D9MemoryChunk::UnmapRange(void* Ptr, uint32_t Size) {
+#ifdef _WIN32
+    UnmapViewOfFile(Ptr);
+#else
+    munmap(Ptr, Size);
+#endif
+    m_allocator->NotifyUnmapped(Size);
   }
 
   void* D3D9MemoryChunk::Map(D3D9Memory* memory) {
@@ -104,31 +203,22 @@ namespace dxvk {
       alignmentDelta = memory->GetOffset() - alignedOffset;
       alignedSize = memory->GetSize() + alignmentDelta;
 
-      m_allocator->NotifyMapped(alignedSize);
-      uint8_t* basePtr = static_cast<uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, alignedOffset, alignedSize));
-      if (unlikely(basePtr == nullptr)) {
-        DWORD error = GetLastError();
-        Logger::err(str::format("Mapping non-persisted file failed: ", error, ", Mapped memory: ", m_allocator->MappedMemory()));
+      uint8_t* basePtr = static_cast<uint8_t*>(MapRange(alignedOffset, alignedSize));
+      if (unlikely(basePtr == nullptr))
         return nullptr;
-      }
       return basePtr + alignmentDelta;
     }
 
     // For small allocations we map the entire mapping page to minimize the overhead from having the align the offset to 65k bytes.
     // This should hopefully also reduce the amount of MapViewOfFile calls we do for tiny allocations.
+    // Mapping pages that are no longer in use stay mapped until the allocator decides to unmap them.
     auto& mappingRange = m_mappingRanges[memory->GetOffset() /  m_mappingGranularity];
-    if (unlikely(mappingRange.refCount == 0)) {
-      m_allocator->NotifyMapped(m_mappingGranularity);
-      mappingRange.ptr = static_cast<uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, alignedOffset, m_mappingGranularity));
-      if (unlikely(mappingRange.ptr == nullptr)) {
-        DWORD error = GetLastError();
-        LPTSTR buffer = nullptr;
-        FormatMessage(FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM, nullptr, error, MAKELANGID(LANG_NEUTRAL, SUBLANG_NEUTRAL), (LPTSTR)&buffer, 0, nullptr);
-        Logger::err(str::format("Mapping non-persisted file failed: ", error, ", Mapped memory: ", m_allocator->MappedMemory(), ", Msg: ", buffer));
-        if (buffer) {
-          LocalFree(buffer);
-        }
-      }
+    if (unlikely(mappingRange.ptr == nullptr)) {
+      mappingRange.ptr = MapRange(alignedOffset, m_mappingGranularity);
+      if (unlikely(mappingRange.ptr == nullptr))
+        return nullptr;
+    } else if (mappingRange.refCount == 0) {
+      m_allocator->NotifyReused(m_mappingGranularity);
     }
     mappingRange.refCount++;
     uint8_t* basePtr = static_cast<uint8_t*>(mappingRange.ptr);
@@ -136,28 +226,47 @@ namespace dxvk {
   }
 
   void D3D9MemoryChunk::Unmap(D3D9Memory* memory) {
-    std::lock_guard<dxvk::mutex> lock(m_mutex);
+    { std::lock_guard<dxvk::mutex> lock(m_mutex);
+
+      uint32_t alignedOffset = alignDown(memory->GetOffset(), m_mappingGranularity);
+      uint32_t alignmentDelta = memory->GetOffset() - alignedOffset;
+      uint32_t alignedSize = memory->GetSize() + alignmentDelta;
+      if (alignedSize > m_mappingGranularity) {
+        // Single use mapping
+        alignedOffset = alignDown(memory->GetOffset(), m_allocator->MemoryGranularity());
+        alignmentDelta = memory->GetOffset() - alignedOffset;
+        alignedSize = memory->GetSize() + alignmentDelta;
+
+        uint8_t* basePtr = static_cast<uint8_t*>(memory->Ptr()) - alignmentDelta;
+        UnmapRange(basePtr, alignedSize);
+        return;
+      }
+      auto& mappingRange = m_mappingRanges[memory->GetOffset() /  m_mappingGranularity];
+      mappingRange.refCount--;
+      if (likely(mappingRange.refCount != 0))
+        return;
+
+      // Account for the idle mapping while still holding the chunk
+      // lock so that this is always ordered with NotifyReused.
+      m_allocator->NotifyIdle(m_mappingGranularity);
+    }
 
-    uint32_t alignedOffset = alignDown(memory->GetOffset(), m_mappingGranularity);
-    uint32_t alignmentDelta = memory->GetOffset() - alignedOffset;
-    uint32_t alignedSize = memory->GetSize() + alignmentDelta;
-    if (alignedSize > m_mappingGranularity) {
-      // Single use mapping
-      alignedOffset = alignDown(memory->GetOffset(), m_allocator->MemoryGranularity());
-      alignmentDelta = memory->GetOffset() - alignedOffset;
-      alignedSize = memory->GetSize() + alignmentDelta;
+    // Keep the mapping around for now, the allocator will unmap the
+    // least recently used chunks once there are too many idle mappings.
+    // This must be called without holding the chunk lock.
+    m_allocator->TrackIdleChunk(this);
+  }
 
-      uint8_t* basePtr = static_cast<uint8_t*>(memory->Ptr()) - alignmentDelta;
-      UnmapViewOfFile(basePtr);
-      m_allocator->NotifyUnmapped(alignedSize);
-      return;
-    }
-    auto& mappingRange = m_mappingRanges[memory->GetOffset() /  m_mappingGranularity];
-    mappingRange.refCount--;
-    if (unlikely(mappingRange.refCount == 0)) {
-      UnmapViewOfFile(mappingRange.ptr);
-      mappingRange.ptr = nullptr;
-      m_allocator->NotifyUnmapped(m_mappingGranularity);
+  void D3D9MemoryChunk::UnmapIdleRanges() {
+    std::lock_guard<dxvk::mutex> lock(m_mutex);
+
+    for (auto& mappingRange : m_mappingRanges) {
+      if (mappingRange.refCount == 0 && mappingRange.ptr != nullptr) {
+        // The range stops being idle before it gets unmapped
+        m_allocator->NotifyReused(m_mappingGranularity);
+        UnmapRange(mappingRange.ptr, m_mappingGranularity);
+        mappingRange.ptr = nullptr;
+      }
     }
   }
 
@@ -182,7 +291,7 @@ namespace dxvk {
     }
 
     if (size != 0)
-      return D3D9Memory(this, offset, Size);
+      return D3D9Memory(this, offset, size);
 
     return {};
   }
@@ -224,9 +333,15 @@ namespace dxvk {
     return m_allocator;
   }
 
+#ifdef _WIN32
   HANDLE D3D9MemoryChunk::FileHandle() const {
     return m_mapping;
   }
+#else
+  int D3D9MemoryChunk::FileDescriptor() const {
+    return m_fd;
+  }
+#endif
 
 
   D3D9Memory::D3D9Memory(D3D9MemoryChunk* Chunk, size_t Offset, size_t Size)
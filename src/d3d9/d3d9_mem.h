@@ -3,11 +3,15 @@
 
 #include "../util/thread.h"
 
+#include "../util/util_lru.h"
+
 #if defined(_WIN32) && !defined(_WIN64)
   #define D3D9_ALLOW_UNMAPPING
+#elif defined(__linux__) && !defined(__LP64__)
+  #define D3D9_ALLOW_UNMAPPING
 #endif
 
-#ifdef D3D9_ALLOW_UNMAPPING
+#if defined(D3D9_ALLOW_UNMAPPING) && defined(_WIN32)
   #define WIN32_LEAN_AND_MEAN
   #include <winbase.h>
 #endif
@@ -25,6 +29,11 @@ namespace dxvk {
 
   constexpr uint32_t D3D9ChunkSize = 64 << 20;
 
+  // Amount of address space that mappings which are no longer
+  // in use may occupy before the least recently used chunks
+  // get unmapped.
+  constexpr uint32_t D3D9IdleMappingBudget = 16 << 20;
+
   struct D3D9MemoryRange {
     uint32_t offset;
     uint32_t length;
@@ -52,16 +61,28 @@ namespace dxvk {
       bool IsEmpty();
       uint32_t Size() const { return m_size; }
       D3D9MemoryAllocator* Allocator() const;
+#ifdef _WIN32
       HANDLE FileHandle() const;
+#else
+      int FileDescriptor() const;
+#endif
       void* Map(D3D9Memory* memory);
       void Unmap(D3D9Memory* memory);
+      void UnmapIdleRanges();
 
     private:
       D3D9MemoryChunk(D3D9MemoryAllocator* Allocator, uint32_t Size);
 
+      void* MapRange(uint32_t Offset, uint32_t Size);
+      void UnmapRange(void* Ptr, uint32_t Size);
+
       dxvk::mutex m_mutex;
       D3D9MemoryAllocator* m_allocator;
+#ifdef _WIN32
       HANDLE m_mapping;
+#else
+      int m_fd;
+#endif
       uint32_t m_size;
       uint32_t m_mappingGranularity;
       std::vector<D3D9MemoryRange> m_freeRanges;
@@ -110,16 +131,24 @@ namespace dxvk {
       void FreeChunk(D3D9MemoryChunk* Chunk);
       void NotifyMapped(uint32_t Size);
       void NotifyUnmapped(uint32_t Size);
+      void NotifyIdle(uint32_t Size);
+      void NotifyReused(uint32_t Size);
+      void TrackIdleChunk(D3D9MemoryChunk* Chunk);
       void NotifyFreed(uint32_t Size);
       uint32_t MappedMemory();
+      uint32_t IdleMappedMemory();
       uint32_t UsedMemory();
       uint32_t AllocatedMemory();
       uint32_t MemoryGranularity() { return m_allocationGranularity; }
 
     private:
+      void UnmapColdChunks();
+
       dxvk::mutex m_mutex;
       std::vector<std::unique_ptr<D3D9MemoryChunk>> m_chunks;
+      lru_list<D3D9MemoryChunk*> m_idleChunks;
       std::atomic<size_t> m_mappedMemory = 0;
+      std::atomic<size_t> m_idleMappedMemory = 0;
       std::atomic<size_t> m_allocatedMemory = 0;
       std::atomic<size_t> m_usedMemory = 0;
       uint32_t m_allocationGranularity;
@@ -124,6 +124,10 @@ namespace dxvk {
     /// don't match entirely to the regular vertex shader in this way.
     bool longMad;
 
+    /// Store float constants of pixel shaders that only use a few
+    /// of them in push constants rather than a constant buffer
+    bool pushConstantFloats;
+
     /// Cached dynamic buffers: Maps all buffers in cached memory.
     bool cachedDynamicBuffers;
 
@@ -147,6 +151,10 @@ namespace dxvk {
     /// How much virtual memory will be used for textures (in MB).
     int32_t textureMemory;
 
+    /// Number of seconds after which system memory copies of
+    /// textures that have not been locked get compressed.
+    int32_t coldTextureTimeout;
+
     /// Shader dump path
     std::string shaderDumpPath;
 
@@ -155,6 +163,11 @@ namespace dxvk {
 
     /// Disable counting losable resources and rejecting calls to Reset() if any are still alive
     bool countLosableResources;
+
+    /// Number of frames for which occlusion queries may return
+    /// the previous result of the same query while the current
+    /// result is still pending. Disabled if set to 0.
+    int32_t occlusionQueryLatency;
   };
 
 }
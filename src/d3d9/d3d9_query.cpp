@@ -21,9 +21,14 @@ namespace dxvk {
         break;
 
       case D3DQUERYTYPE_OCCLUSION:
-        m_query[0] = dxvkDevice->createGpuQuery(
-          VK_QUERY_TYPE_OCCLUSION,
-          VK_QUERY_CONTROL_PRECISE_BIT, 0);
+        m_latency = uint32_t(std::clamp(m_parent->GetOptions()->occlusionQueryLatency,
+          0, int32_t(MaxGpuQueries - 1)));
+
+        for (uint32_t i = 0; i <= m_latency; i++) {
+          m_query[i] = dxvkDevice->createGpuQuery(
+            VK_QUERY_TYPE_OCCLUSION,
+            VK_QUERY_CONTROL_PRECISE_BIT, 0);
+        }
         break;
 
       case D3DQUERYTYPE_TIMESTAMP:
@@ -99,10 +104,10 @@ namespace dxvk {
 
     if (dwIssueFlags == D3DISSUE_BEGIN) {
       if (QueryBeginnable(m_queryType)) {
-        if (m_state == D3D9_VK_QUERY_BEGUN && QueryEndable(m_queryType)) {
-          m_resetCtr.fetch_add(1, std::memory_order_acquire);
-          m_parent->End(this);
-        }
+        if (m_state == D3D9_VK_QUERY_BEGUN && QueryEndable(m_queryType))
+          this->EndQuery();
+        else if (m_state != D3D9_VK_QUERY_INITIAL && m_latency)
+          this->AdvanceQuerySlot();
 
         m_parent->Begin(this);
 
@@ -111,13 +116,14 @@ namespace dxvk {
     }
     else {
       if (QueryEndable(m_queryType)) {
-        if (m_state != D3D9_VK_QUERY_BEGUN && QueryBeginnable(m_queryType))
-          m_parent->Begin(this);
+        if (m_state != D3D9_VK_QUERY_BEGUN && QueryBeginnable(m_queryType)) {
+          if (m_state != D3D9_VK_QUERY_INITIAL && m_latency)
+            this->AdvanceQuerySlot();
 
-        m_resetCtr.fetch_add(1, std::memory_order_acquire);
-
-        m_parent->End(this);
+          m_parent->Begin(this);
+        }
 
+        this->EndQuery();
       }
       m_state = D3D9_VK_QUERY_ENDED;
     }
@@ -151,11 +157,19 @@ namespace dxvk {
 
     HRESULT hr = this->GetQueryData(pData, dwSize);
 
+    // Fall back to an older result if the current one is pending
+    if (hr == S_FALSE && m_state == D3D9_VK_QUERY_ENDED && m_latency)
+      hr = this->GetPredictedData(pData, dwSize);
+
     // If we get S_FALSE and it's not from the fact
     // they didn't call end, do some flushy stuff...
     if (flush && hr == S_FALSE && m_state != D3D9_VK_QUERY_BEGUN) {
       this->NotifyStall();
-      m_parent->ConsiderFlush(GpuFlushType::ImplicitSynchronization);
+
+      // Flushing again does not help if the query
+      // has already been submitted to the GPU
+      if (!m_parent->IsFlushed(m_endSeqNum))
+        m_parent->ConsiderFlush(GpuFlushType::ImplicitSynchronization);
     }
 
     return hr;
@@ -198,10 +212,12 @@ namespace dxvk {
       }
     }
     else {
-      std::array<DxvkQueryData, MaxGpuQueries> queryData = { };
+      std::array<DxvkQueryData, 2> queryData = { };
 
-      for (uint32_t i = 0; i < MaxGpuQueries && m_query[i] != nullptr; i++) {
-        DxvkGpuQueryStatus status = m_query[i]->getData(queryData[i]);
+      uint32_t queryCount = m_queryType == D3DQUERYTYPE_TIMESTAMPDISJOINT ? 2u : 1u;
+
+      for (uint32_t i = 0; i < queryCount && m_query[m_querySlot + i] != nullptr; i++) {
+        DxvkGpuQueryStatus status = m_query[m_querySlot + i]->getData(queryData[i]);
 
         if (status == DxvkGpuQueryStatus::Invalid
          || status == DxvkGpuQueryStatus::Failed)
@@ -211,6 +227,11 @@ namespace dxvk {
           return S_FALSE;
       }
 
+      if (m_latency) {
+        m_lastSerial = m_querySerial[m_querySlot];
+        m_lastOcclusion = DWORD(queryData[0].occlusion.samplesPassed);
+      }
+
       if (pData == nullptr)
         return D3D_OK;
 
@@ -254,6 +275,63 @@ namespace dxvk {
   }
 
 
+  void D3D9Query::EndQuery() {
+    m_resetCtr.fetch_add(1, std::memory_order_acquire);
+
+    m_parent->End(this);
+
+    m_queryFrame[m_querySlot] = m_parent->GetFrameId();
+    m_querySerial[m_querySlot] = ++m_serial;
+  }
+
+
+  void D3D9Query::AdvanceQuerySlot() {
+    this->UpdatePredictedData();
+
+    // If the query in the next slot is still pending, its
+    // result gets discarded when the query is restarted.
+    m_querySlot = (m_querySlot + 1) % (m_latency + 1);
+    m_querySerial[m_querySlot] = 0;
+  }
+
+
+  void D3D9Query::UpdatePredictedData() {
+    // Queries must not be accessed until the CS thread
+    // has executed all pending begin and end commands
+    if (m_resetCtr.load(std::memory_order_acquire))
+      return;
+
+    for (uint32_t i = 0; i <= m_latency; i++) {
+      if (i == m_querySlot || m_querySerial[i] <= m_lastSerial)
+        continue;
+
+      DxvkQueryData queryData = { };
+
+      if (m_query[i]->getData(queryData) == DxvkGpuQueryStatus::Available) {
+        m_lastSerial = m_querySerial[i];
+        m_lastOcclusion = DWORD(queryData.occlusion.samplesPassed);
+      }
+    }
+  }
+
+
+  HRESULT D3D9Query::GetPredictedData(void* pData, DWORD dwSize) {
+    this->UpdatePredictedData();
+
+    if (!m_lastSerial || m_parent->GetFrameId() > m_queryFrame[m_querySlot] + m_latency)
+      return S_FALSE;
+
+    if (likely(pData && dwSize)) {
+      D3D9_QUERY_DATA data = { };
+      data.Occlusion = m_lastOcclusion;
+
+      memcpy(pData, &data, dwSize);
+    }
+
+    return D3D_OK;
+  }
+
+
   UINT64 D3D9Query::GetTimestampQueryFrequency() const {
     Rc<DxvkDevice>  device  = m_parent->GetDXVKDevice();
     Rc<DxvkAdapter> adapter = device->adapter();
@@ -263,10 +341,10 @@ namespace dxvk {
   }
 
 
-  void D3D9Query::Begin(DxvkContext* ctx) {
+  void D3D9Query::Begin(DxvkContext* ctx, uint32_t QuerySlot) {
     switch (m_queryType) {
       case D3DQUERYTYPE_OCCLUSION:
-        ctx->beginQuery(m_query[0]);
+        ctx->beginQuery(m_query[QuerySlot]);
         break;
 
       case D3DQUERYTYPE_TIMESTAMPDISJOINT:
@@ -278,7 +356,7 @@ namespace dxvk {
   }
 
 
-  void D3D9Query::End(DxvkContext* ctx) {
+  void D3D9Query::End(DxvkContext* ctx, uint32_t QuerySlot) {
     switch (m_queryType) {
       case D3DQUERYTYPE_TIMESTAMP:
       case D3DQUERYTYPE_TIMESTAMPDISJOINT:
@@ -286,7 +364,7 @@ namespace dxvk {
         break;
 
       case D3DQUERYTYPE_OCCLUSION:
-        ctx->endQuery(m_query[0]);
+        ctx->endQuery(m_query[QuerySlot]);
         break;
 
       case D3DQUERYTYPE_EVENT:
@@ -23,7 +23,7 @@ namespace dxvk {
   };
 
   class D3D9Query : public D3D9DeviceChild<IDirect3DQuery9> {
-    constexpr static uint32_t MaxGpuQueries = 2;
+    constexpr static uint32_t MaxGpuQueries = 4;
     constexpr static uint32_t MaxGpuEvents  = 1;
   public:
 
@@ -43,8 +43,8 @@ namespace dxvk {
 
     HRESULT GetQueryData(void* pData, DWORD dwSize);
 
-    void Begin(DxvkContext* ctx);
-    void End(DxvkContext* ctx);
+    void Begin(DxvkContext* ctx, uint32_t QuerySlot);
+    void End(DxvkContext* ctx, uint32_t QuerySlot);
 
     static bool QueryBeginnable(D3DQUERYTYPE QueryType);
     static bool QueryEndable(D3DQUERYTYPE QueryType);
@@ -59,8 +59,9 @@ namespace dxvk {
       return m_stallFlag;
     }
 
-    void NotifyEnd() {
+    void NotifyEnd(uint64_t SequenceNumber) {
       m_stallMask <<= 1;
+      m_endSeqNum = SequenceNumber;
     }
 
     void NotifyStall() {
@@ -68,6 +69,10 @@ namespace dxvk {
       m_stallFlag |= bit::popcnt(m_stallMask) >= 16;
     }
 
+    uint32_t GetQuerySlot() const {
+      return m_querySlot;
+    }
+
   private:
 
     D3DQUERYTYPE      m_queryType;
@@ -80,10 +85,33 @@ namespace dxvk {
     uint32_t m_stallMask = 0;
     bool     m_stallFlag = false;
 
+    uint64_t m_endSeqNum = 0;
+
     std::atomic<uint32_t> m_resetCtr = { 0u };
 
     D3D9_QUERY_DATA m_dataCache;
 
+    // Occlusion queries with a non-zero latency rotate through
+    // multiple GPU queries so that older results remain
+    // available while the most recent one is in flight.
+    uint32_t m_latency   = 0;
+    uint32_t m_querySlot = 0;
+
+    std::array<uint64_t, MaxGpuQueries> m_queryFrame  = { };
+    std::array<uint64_t, MaxGpuQueries> m_querySerial = { };
+
+    uint64_t m_serial     = 0;
+    uint64_t m_lastSerial = 0;
+    DWORD    m_lastOcclusion = 0;
+
+    void EndQuery();
+
+    void AdvanceQuerySlot();
+
+    void UpdatePredictedData();
+
+    HRESULT GetPredictedData(void* pData, DWORD dwSize);
+
     UINT64 GetTimestampQueryFrequency() const;
 
   };
@@ -46,6 +46,16 @@ namespace dxvk {
     float pointScaleC  = 0.0f;
   };
 
+  /// Pixel shaders that only use a few float constants read them from
+  /// push constants, stored directly after the render state info. All
+  /// shaders declare the same push constant size so that pipeline
+  /// layouts remain compatible when linking pipeline libraries.
+  static constexpr uint32_t D3D9PushConstantSize        = MaxPushConstantSize;
+  static constexpr uint32_t D3D9PushConstantFloatOffset = 64u;
+  static constexpr uint32_t D3D9PushConstantFloatCount  = (D3D9PushConstantSize - D3D9PushConstantFloatOffset) / sizeof(Vector4);
+
+  static_assert(sizeof(D3D9RenderStateInfo) <= D3D9PushConstantFloatOffset);
+
   enum class D3D9RenderStateItem {
     FogColor   = 0,
     FogScale   = 1,
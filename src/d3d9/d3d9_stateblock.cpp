@@ -68,6 +68,60 @@ namespace dxvk {
   }
 
 
+  void D3D9StateBlock::Compile() {
+    m_compiled = D3D9CompiledStateBlock();
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::StreamFreq))
+      CompileStateIndices(m_compiled.streamFreq, m_captures.streamFreq);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::RenderStates))
+      CompileStateIndices(m_compiled.renderStates, m_captures.renderStates);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::SamplerStates)) {
+      for (uint32_t samplerIdx : bit::BitMask(m_captures.samplers.dword(0))) {
+        for (uint32_t stateIdx : bit::BitMask(m_captures.samplerStates[samplerIdx].dword(0)))
+          m_compiled.samplerStates.push_back({ uint8_t(samplerIdx), uint8_t(stateIdx) });
+      }
+    }
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::VertexBuffers))
+      CompileStateIndices(m_compiled.vertexBuffers, m_captures.vertexBuffers);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::Textures))
+      CompileStateIndices(m_compiled.textures, m_captures.textures);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::Transforms))
+      CompileStateIndices(m_compiled.transforms, m_captures.transforms);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::TextureStages)) {
+      for (uint32_t stageIdx : bit::BitMask(m_captures.textureStages.dword(0))) {
+        for (uint32_t stateIdx : bit::BitMask(m_captures.textureStageStates[stageIdx].dword(0)))
+          m_compiled.textureStageStates.push_back({ uint8_t(stageIdx), uint8_t(stateIdx) });
+      }
+    }
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::ClipPlanes))
+      CompileStateIndices(m_compiled.clipPlanes, m_captures.clipPlanes);
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::VsConstants)) {
+      CompileRegisterRanges(m_compiled.vsConsts.fConsts, m_captures.vsConsts.fConsts);
+      CompileRegisterRanges(m_compiled.vsConsts.iConsts, m_captures.vsConsts.iConsts);
+    }
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::PsConstants)) {
+      CompileRegisterRanges(m_compiled.psConsts.fConsts, m_captures.psConsts.fConsts);
+      CompileRegisterRanges(m_compiled.psConsts.iConsts, m_captures.psConsts.iConsts);
+    }
+
+    if (m_captures.flags.test(D3D9CapturedStateFlag::Lights)) {
+      for (uint32_t i = 0; i < m_captures.lightEnabledChanges.dwordCount(); i++) {
+        for (uint32_t idx : bit::BitMask(m_captures.lightEnabledChanges.dword(i)))
+          m_compiled.lightEnabledChanges.push_back(i * 32 + idx);
+      }
+    }
+  }
+
+
   HRESULT D3D9StateBlock::SetVertexDeclaration(D3D9VertexDecl* pDecl) {
     m_state.vertexDecl = pDecl;
 
@@ -572,8 +626,38 @@ namespace dxvk {
       m_captures.flags.set(D3D9CapturedStateFlag::Material);
     }
 
+    Compile();
+
     if (Type != D3D9StateBlockType::None)
       this->Capture();
   }
 
+
+  template <typename T, size_t N>
+  void D3D9StateBlock::CompileStateIndices(
+          std::vector<T>&                       list,
+    const bit::bitset<N>&                       mask) {
+    for (uint32_t i = 0; i < mask.dwordCount(); i++) {
+      for (uint32_t idx : bit::BitMask(mask.dword(i)))
+        list.push_back(T(i * 32 + idx));
+    }
+  }
+
+
+  template <size_t N>
+  void D3D9StateBlock::CompileRegisterRanges(
+          std::vector<D3D9CompiledStateBlock::RegisterRange>& list,
+    const bit::bitset<N>&                       mask) {
+    for (uint32_t i = 0; i < mask.dwordCount(); i++) {
+      for (uint32_t idx : bit::BitMask(mask.dword(i))) {
+        uint32_t reg = i * 32 + idx;
+
+        if (!list.empty() && list.back().first + list.back().count == reg)
+          list.back().count += 1;
+        else
+          list.push_back({ uint16_t(reg), uint16_t(1) });
+      }
+    }
+  }
+
 }
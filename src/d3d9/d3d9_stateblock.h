@@ -66,6 +66,42 @@ namespace dxvk {
     bit::bitvector                                      lightEnabledChanges;
   };
 
+  /**
+   * \brief Compiled state block
+   *
+   * Flat lists of captured state indices, built once the set of
+   * captured states is final, so that applying or capturing a
+   * state block does not need to walk all the capture bit masks.
+   * Shader constants are merged into contiguous register ranges.
+   */
+  struct D3D9CompiledStateBlock {
+    struct StateIndex {
+      uint8_t   index;
+      uint8_t   state;
+    };
+
+    struct RegisterRange {
+      uint16_t  first;
+      uint16_t  count;
+    };
+
+    std::vector<uint8_t>                                streamFreq;
+    std::vector<uint16_t>                               renderStates;
+    std::vector<StateIndex>                             samplerStates;
+    std::vector<uint8_t>                                vertexBuffers;
+    std::vector<uint8_t>                                textures;
+    std::vector<uint16_t>                               transforms;
+    std::vector<StateIndex>                             textureStageStates;
+    std::vector<uint8_t>                                clipPlanes;
+
+    struct {
+      std::vector<RegisterRange>                        fConsts;
+      std::vector<RegisterRange>                        iConsts;
+    } vsConsts, psConsts;
+
+    std::vector<uint32_t>                               lightEnabledChanges;
+  };
+
   enum class D3D9StateBlockType :uint32_t {
     None,
     VertexState,
@@ -183,49 +219,32 @@ namespace dxvk {
 
     template <typename Dst, typename Src>
     void ApplyOrCapture(Dst* dst, const Src* src) {
-      if (m_captures.flags.test(D3D9CapturedStateFlag::StreamFreq)) {
-        for (uint32_t idx : bit::BitMask(m_captures.streamFreq.dword(0)))
-          dst->SetStreamSourceFreq(idx, src->streamFreq[idx]);
-      }
+      for (uint32_t idx : m_compiled.streamFreq)
+        dst->SetStreamSourceFreq(idx, src->streamFreq[idx]);
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::Indices))
         dst->SetIndices(src->indices.ptr());
 
-      if (m_captures.flags.test(D3D9CapturedStateFlag::RenderStates)) {
-        for (uint32_t i = 0; i < m_captures.renderStates.dwordCount(); i++) {
-          for (uint32_t rs : bit::BitMask(m_captures.renderStates.dword(i))) {
-            uint32_t idx = i * 32 + rs;
+      for (uint32_t idx : m_compiled.renderStates)
+        dst->SetRenderState(D3DRENDERSTATETYPE(idx), src->renderStates[idx]);
 
-            dst->SetRenderState(D3DRENDERSTATETYPE(idx), src->renderStates[idx]);
-          }
-        }
-      }
+      for (auto entry : m_compiled.samplerStates)
+        dst->SetStateSamplerState(entry.index, D3DSAMPLERSTATETYPE(entry.state), src->samplerStates[entry.index][entry.state]);
 
-      if (m_captures.flags.test(D3D9CapturedStateFlag::SamplerStates)) {
-        for (uint32_t samplerIdx : bit::BitMask(m_captures.samplers.dword(0))) {
-          for (uint32_t stateIdx : bit::BitMask(m_captures.samplerStates[samplerIdx].dword(0)))
-            dst->SetStateSamplerState(samplerIdx, D3DSAMPLERSTATETYPE(stateIdx), src->samplerStates[samplerIdx][stateIdx]);
-        }
-      }
-
-      if (m_captures.flags.test(D3D9CapturedStateFlag::VertexBuffers)) {
-        for (uint32_t idx : bit::BitMask(m_captures.vertexBuffers.dword(0))) {
-          const auto& vbo = src->vertexBuffers[idx];
-          dst->SetStreamSource(
-            idx,
-            vbo.vertexBuffer.ptr(),
-            vbo.offset,
-            vbo.stride);
-        }
+      for (uint32_t idx : m_compiled.vertexBuffers) {
+        const auto& vbo = src->vertexBuffers[idx];
+        dst->SetStreamSource(
+          idx,
+          vbo.vertexBuffer.ptr(),
+          vbo.offset,
+          vbo.stride);
       }
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::Material))
         dst->SetMaterial(&src->material);
 
-      if (m_captures.flags.test(D3D9CapturedStateFlag::Textures)) {
-        for (uint32_t idx : bit::BitMask(m_captures.textures.dword(0)))
-          dst->SetStateTexture(idx, src->textures[idx]);
-      }
+      for (uint32_t idx : m_compiled.textures)
+        dst->SetStateTexture(idx, src->textures[idx]);
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::VertexShader))
         dst->SetVertexShader(src->vertexShader.ptr());
@@ -233,22 +252,11 @@ namespace dxvk {
       if (m_captures.flags.test(D3D9CapturedStateFlag::PixelShader))
         dst->SetPixelShader(src->pixelShader.ptr());
 
-      if (m_captures.flags.test(D3D9CapturedStateFlag::Transforms)) {
-        for (uint32_t i = 0; i < m_captures.transforms.dwordCount(); i++) {
-          for (uint32_t trans : bit::BitMask(m_captures.transforms.dword(i))) {
-            uint32_t idx = i * 32 + trans;
+      for (uint32_t idx : m_compiled.transforms)
+        dst->SetStateTransform(idx, reinterpret_cast<const D3DMATRIX*>(&src->transforms[idx]));
 
-            dst->SetStateTransform(idx, reinterpret_cast<const D3DMATRIX*>(&src->transforms[idx]));
-          }
-        }
-      }
-
-      if (m_captures.flags.test(D3D9CapturedStateFlag::TextureStages)) {
-        for (uint32_t stageIdx : bit::BitMask(m_captures.textureStages.dword(0))) {
-          for (uint32_t stateIdx : bit::BitMask(m_captures.textureStageStates[stageIdx].dword(0)))
-            dst->SetStateTextureStageState(stageIdx, D3D9TextureStageStateTypes(stateIdx), src->textureStages[stageIdx][stateIdx]);
-        }
-      }
+      for (auto entry : m_compiled.textureStageStates)
+        dst->SetStateTextureStageState(entry.index, D3D9TextureStageStateTypes(entry.state), src->textureStages[entry.index][entry.state]);
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::Viewport))
         dst->SetViewport(&src->viewport);
@@ -256,27 +264,15 @@ namespace dxvk {
       if (m_captures.flags.test(D3D9CapturedStateFlag::ScissorRect))
         dst->SetScissorRect(&src->scissorRect);
 
-      if (m_captures.flags.test(D3D9CapturedStateFlag::ClipPlanes)) {
-        for (uint32_t idx : bit::BitMask(m_captures.clipPlanes.dword(0)))
-          dst->SetClipPlane(idx, src->clipPlanes[idx].coeff);
-      }
+      for (uint32_t idx : m_compiled.clipPlanes)
+        dst->SetClipPlane(idx, src->clipPlanes[idx].coeff);
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::VsConstants)) {
-        for (uint32_t i = 0; i < m_captures.vsConsts.fConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.vsConsts.fConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
+        for (auto range : m_compiled.vsConsts.fConsts)
+          dst->SetVertexShaderConstantF(range.first, (float*)&src->vsConsts->fConsts[range.first], range.count);
 
-            dst->SetVertexShaderConstantF(idx, (float*)&src->vsConsts->fConsts[idx], 1);
-          }
-        }
-
-        for (uint32_t i = 0; i < m_captures.vsConsts.iConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.vsConsts.iConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetVertexShaderConstantI(idx, (int*)&src->vsConsts->iConsts[idx], 1);
-          }
-        }
+        for (auto range : m_compiled.vsConsts.iConsts)
+          dst->SetVertexShaderConstantI(range.first, (int*)&src->vsConsts->iConsts[range.first], range.count);
 
         if (m_captures.vsConsts.bConsts.any()) {
           for (uint32_t i = 0; i < m_captures.vsConsts.bConsts.dwordCount(); i++)
@@ -285,21 +281,11 @@ namespace dxvk {
       }
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::PsConstants)) {
-        for (uint32_t i = 0; i < m_captures.psConsts.fConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.psConsts.fConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
+        for (auto range : m_compiled.psConsts.fConsts)
+          dst->SetPixelShaderConstantF(range.first, (float*)&src->psConsts->fConsts[range.first], range.count);
 
-            dst->SetPixelShaderConstantF(idx, (float*)&src->psConsts->fConsts[idx], 1);
-          }
-        }
-
-        for (uint32_t i = 0; i < m_captures.psConsts.iConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.psConsts.iConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetPixelShaderConstantI(idx, (int*)&src->psConsts->iConsts[idx], 1);
-          }
-        }
+        for (auto range : m_compiled.psConsts.iConsts)
+          dst->SetPixelShaderConstantI(range.first, (int*)&src->psConsts->iConsts[range.first], range.count);
 
         if (m_captures.psConsts.bConsts.any()) {
           for (uint32_t i = 0; i < m_captures.psConsts.bConsts.dwordCount(); i++)
@@ -314,13 +300,9 @@ namespace dxvk {
 
           dst->SetLight(i, &src->lights[i].value());
         }
-        for (uint32_t i = 0; i < m_captures.lightEnabledChanges.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.lightEnabledChanges.dword(i))) {
-            uint32_t idx = i * 32 + consts;
 
-            dst->LightEnable(idx, src->IsLightEnabled(idx));
-          }
-        }
+        for (uint32_t idx : m_compiled.lightEnabledChanges)
+          dst->LightEnable(idx, src->IsLightEnabled(idx));
       }
     }
 
@@ -381,6 +363,16 @@ namespace dxvk {
       return m_applying;
     }
 
+    /**
+     * \brief Compiles the set of captured states
+     *
+     * Must be called whenever the set of captured states
+     * changes, i.e. when the state block has been created
+     * or recording has ended. Capturing the current state
+     * only updates values and does not require this.
+     */
+    void Compile();
+
   private:
 
     void CapturePixelRenderStates();
@@ -393,8 +385,19 @@ namespace dxvk {
 
     void CaptureType(D3D9StateBlockType State);
 
-    D3D9CapturableState  m_state;
-    D3D9StateCaptures    m_captures;
+    template <typename T, size_t N>
+    static void CompileStateIndices(
+            std::vector<T>&                       list,
+      const bit::bitset<N>&                       mask);
+
+    template <size_t N>
+    static void CompileRegisterRanges(
+            std::vector<D3D9CompiledStateBlock::RegisterRange>& list,
+      const bit::bitset<N>&                       mask);
+
+    D3D9CapturableState    m_state;
+    D3D9StateCaptures      m_captures;
+    D3D9CompiledStateBlock m_compiled;
 
     D3D9DeviceState* m_deviceState;
 
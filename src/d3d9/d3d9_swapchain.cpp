@@ -1088,10 +1088,15 @@ namespace dxvk {
     if (m_hud != nullptr) {
       m_hud->addItem<hud::HudClientApiItem>("api", 1, GetApiName());
       m_hud->addItem<hud::HudSamplerCount>("samplers", -1, m_parent);
+      m_hud->addItem<hud::HudConstantUploads>("constants", -1, m_parent);
+      m_hud->addItem<hud::HudFastDraws>("fastdraws", -1, m_parent);
 
 #ifdef D3D9_ALLOW_UNMAPPING
       m_hud->addItem<hud::HudTextureMemory>("memory", -1, m_parent);
 #endif
+
+      if (m_parent->GetOptions()->coldTextureTimeout)
+        m_hud->addItem<hud::HudColdTextureMemory>("coldmemory", -1, m_parent);
     }
   }
 
@@ -21,6 +21,20 @@ namespace dxvk {
     if (opcode == DxsoOpcode::TexKill)
       m_analysis->usesKill = true;
 
+    // Source operands that the instruction doesn't use may hold
+    // registers from previous instructions, which is fine since
+    // those registers were used by the shader anyway.
+    for (const auto& src : ctx.src) {
+      if (src.id.type == DxsoRegisterType::Const) {
+        if (src.hasRelative)
+          m_analysis->usesRelativeConstants = true;
+        else
+          m_analysis->floatConstantCount = std::max(m_analysis->floatConstantCount, src.id.num + 1);
+      } else if (src.id.type == DxsoRegisterType::ConstInt) {
+        m_analysis->usesIntConstants = true;
+      }
+    }
+
     if (opcode == DxsoOpcode::DsX
      || opcode == DxsoOpcode::DsY
 
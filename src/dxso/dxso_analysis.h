@@ -11,6 +11,10 @@ namespace dxvk {
     bool usesDerivatives = false;
     bool usesKill        = false;
 
+    uint32_t floatConstantCount    = 0;
+    bool     usesRelativeConstants = false;
+    bool     usesIntConstants      = false;
+
     std::vector<DxsoInstructionContext> coissues;
   };
 
@@ -229,7 +229,7 @@ namespace dxvk {
     info.inputMask = m_inputMask;
     info.outputMask = m_outputMask;
     info.pushConstStages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    info.pushConstSize = sizeof(D3D9RenderStateInfo);
+    info.pushConstSize = D3D9PushConstantSize;
 
     if (m_programInfo.type() == DxsoProgramTypes::PixelShader)
       info.flatShadingInputs = m_ps.flatShadingMask;
@@ -242,11 +242,21 @@ namespace dxvk {
     m_module.enableCapability(spv::CapabilityShader);
     m_module.enableCapability(spv::CapabilityImageQuery);
 
+    // Pixel shaders that only use a handful of float constants
+    // can read them from push constants instead of a UBO
+    m_pushConstantFloats = m_programInfo.type() == DxsoProgramTypes::PixelShader
+      && m_moduleInfo.options.pushConstantFloats
+      && !m_analysis->usesRelativeConstants
+      && !m_analysis->usesIntConstants
+      && m_analysis->floatConstantCount <= D3D9PushConstantFloatCount;
+
+    m_meta.pushConstantFloats = m_pushConstantFloats;
+
     if (isSwvp()) {
       m_cFloatBuffer = this->emitDclSwvpConstantBuffer<DxsoConstantBufferType::Float>();
       m_cIntBuffer = this->emitDclSwvpConstantBuffer<DxsoConstantBufferType::Int>();
       m_cBoolBuffer = this->emitDclSwvpConstantBuffer<DxsoConstantBufferType::Bool>();
-    } else {
+    } else if (!m_pushConstantFloats) {
       this->emitDclConstantBuffer();
     }
 
@@ -923,7 +933,18 @@ namespace dxvk {
 
     uint32_t relativeIdx = this->emitArrayIndex(reg.id.num, relative);
 
-    if (reg.id.type != DxsoRegisterType::ConstBool) {
+    if (reg.id.type == DxsoRegisterType::Const && m_pushConstantFloats) {
+      std::array<uint32_t, 2> indices = {
+        m_module.constu32(uint32_t(D3D9RenderStateItem::Count)),
+        relativeIdx };
+
+      uint32_t typeId = getVectorTypeId(result.type);
+      uint32_t ptrId = m_module.opAccessChain(
+        m_module.defPointerType(typeId, spv::StorageClassPushConstant),
+        m_rsBlock, indices.size(), indices.data());
+
+      result.id = m_module.opLoad(typeId, ptrId);
+    } else if (reg.id.type != DxsoRegisterType::ConstBool) {
       uint32_t structIdx;
       uint32_t cBufferId;
 
@@ -3561,7 +3582,7 @@ void DxsoCompiler::emitControlFlowGenericLoop(
 
 
   void DxsoCompiler::setupRenderStateInfo() {
-    m_rsBlock = SetupRenderStateBlock(m_module);
+    m_rsBlock = SetupRenderStateBlock(m_module, m_pushConstantFloats);
   }
 
 
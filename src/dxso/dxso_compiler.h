@@ -363,6 +363,8 @@ namespace dxvk {
     uint32_t m_rsBlock = 0;
     uint32_t m_mainFuncLabel = 0;
 
+    bool m_pushConstantFloats = false;
+
     //////////////////////////////////////
     // Common function definition methods
     void emitInit();
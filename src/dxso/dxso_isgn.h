@@ -31,6 +31,7 @@ namespace dxvk {
 
   struct DxsoShaderMetaInfo {
     bool needsConstantCopies = false;
+    bool pushConstantFloats = false;
     uint32_t maxConstIndexF = 0;
     uint32_t maxConstIndexI = 0;
     uint32_t maxConstIndexB = 0;
@@ -49,6 +49,10 @@ namespace dxvk {
 
     /// Whether or not we can rely on robustness2 to handle oob constant access
     bool robustness2Supported;
+
+    /// Whether pixel shaders with only a few float constants
+    /// may read them from push constants
+    bool pushConstantFloats;
   };
 
 }
\ No newline at end of file
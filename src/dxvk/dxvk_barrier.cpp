@@ -309,6 +309,30 @@ namespace dxvk {
   }
 
 
+  bool DxvkBarrierSet::finalizeSplit(
+    const Rc<DxvkCommandList>&      commandList,
+          VkEvent                   event,
+    const VkDependencyInfo&         depInfo) {
+    const VkMemoryBarrier2& barrier = depInfo.pMemoryBarriers[0];
+
+    // Layout transitions, queue family ownership transfers and
+    // host access cannot be expressed with the given dependency
+    bool canSplit = !m_hostBarrierSrcStages
+      && m_bufBarriers.empty()
+      && m_imgBarriers.empty()
+      && !(m_memBarrier.srcStageMask & ~barrier.srcStageMask)
+      && !(m_memBarrier.srcAccessMask & ~barrier.srcAccessMask);
+
+    if (canSplit)
+      this->reset();
+    else
+      this->finalize(commandList);
+
+    commandList->cmdSetEvent(m_cmdBuffer, event, &depInfo);
+    return canSplit;
+  }
+
+
   void DxvkBarrierSet::recordCommands(const Rc<DxvkCommandList>& commandList) {
     VkDependencyInfo depInfo = { VK_STRUCTURE_TYPE_DEPENDENCY_INFO };
 
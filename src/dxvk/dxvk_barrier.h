@@ -90,6 +90,16 @@ namespace dxvk {
       return DxvkAccessFlags(m_access);
     }
 
+    /**
+     * \brief Queries range used for indexing
+     *
+     * Slices can only overlap if their
+     * index ranges overlap as well.
+     * \returns Start and end of the byte range
+     */
+    uint64_t getRangeStart() const { return m_loAddr; }
+    uint64_t getRangeEnd() const { return m_hiAddr; }
+
   private:
 
     VkDeviceSize    m_loAddr;
@@ -204,6 +214,16 @@ namespace dxvk {
       return m_access;
     }
 
+    /**
+     * \brief Queries range used for indexing
+     *
+     * Slices can only overlap if their
+     * index ranges overlap as well.
+     * \returns Start and end of the layer range
+     */
+    uint64_t getRangeStart() const { return m_minLayer; }
+    uint64_t getRangeEnd() const { return m_maxLayer; }
+
   private:
 
     VkImageAspectFlags  m_aspects;
@@ -221,13 +241,17 @@ namespace dxvk {
    *
    * Implements a versioned hash table for fast resource
    * lookup, with a single-linked list accurately storing
-   * each accessed slice if necessary.
+   * each accessed slice if necessary. Once the list for
+   * a resource grows too long, slices are moved to an
+   * interval tree instead, so that lookups remain fast
+   * with a large number of disjoint slices.
    * \tparam K Resource handle type
    * \tparam T Resource slice type
    */
   template<typename K, typename T>
   class DxvkBarrierSubresourceSet {
     constexpr static uint32_t NoEntry = ~0u;
+    constexpr static uint32_t MaxListLength = 16;
   public:
 
     /**
@@ -249,6 +273,12 @@ namespace dxvk {
       if (!entry->data.overlaps(slice))
         return DxvkAccessFlags();
 
+      if (entry->tree != NoEntry) {
+        DxvkAccessFlags access;
+        getTreeAccess(entry->tree, slice, access);
+        return access;
+      }
+
       ListEntry* list = getListEntry(entry->next);
 
       if (!list)
@@ -288,6 +318,9 @@ namespace dxvk {
       if (!entry->data.isDirty(slice))
         return false;
 
+      if (entry->tree != NoEntry)
+        return isTreeDirty(entry->tree, slice);
+
       // We know that some subresources are dirty, so if
       // there is no list, the given slice must be dirty.
       ListEntry* list = getListEntry(entry->next);
@@ -321,7 +354,9 @@ namespace dxvk {
       if (hashEntry) {
         ListEntry* listEntry = getListEntry(hashEntry->next);
 
-        if (listEntry) {
+        if (hashEntry->tree != NoEntry) {
+          hashEntry->tree = insertTreeNode(hashEntry->tree, allocTreeNode(slice));
+        } else if (listEntry) {
           if (std::is_same_v<T, DxvkBarrierImageSlice>) {
             // For images, try to merge the slice with existing
             // entries if possible to keep the list small
@@ -346,6 +381,11 @@ namespace dxvk {
           insertListEntry(slice, hashEntry);
         }
 
+        // Lookups are linear in the length of the list, so
+        // move all slices to the interval tree if necessary
+        if (hashEntry->count > MaxListLength)
+          buildTree(hashEntry);
+
         // Merge hash entry data so that it stores
         // a superset of all slices in the list.
         hashEntry->data.merge(slice);
@@ -359,6 +399,7 @@ namespace dxvk {
       m_used = 0;
       m_version += 1;
       m_list.clear();
+      m_tree.clear();
     }
 
     /**
@@ -381,6 +422,19 @@ namespace dxvk {
       K         key;
       T         data;
       uint32_t  next;
+      uint32_t  count;
+      uint32_t  tree;
+    };
+
+    struct TreeNode {
+      T               data;
+      uint64_t        start;
+      uint64_t        end;
+      uint64_t        maxEnd;
+      DxvkAccessFlags access;
+      uint32_t        priority;
+      uint32_t        left;
+      uint32_t        right;
     };
 
     uint64_t m_version = 1ull;
@@ -389,6 +443,7 @@ namespace dxvk {
 
     std::vector<ListEntry> m_list;
     std::vector<HashEntry> m_hashMap;
+    std::vector<TreeNode>  m_tree;
 
     static size_t computeHash(K key) {
       size_t hash = size_t(key) * 93887;
@@ -444,6 +499,8 @@ namespace dxvk {
       entry->key     = key;
       entry->data    = data;
       entry->next    = NoEntry;
+      entry->count   = 0;
+      entry->tree    = NoEntry;
 
       m_used += 1;
       return nullptr;
@@ -491,9 +548,159 @@ namespace dxvk {
       uint32_t newIndex = uint32_t(m_list.size());
       m_list.push_back({ subresource, head->next });
       head->next = newIndex;
+      head->count += 1;
       return &m_list[newIndex];
     }
 
+    void buildTree(HashEntry* head) {
+      ListEntry* list = getListEntry(head->next);
+
+      while (list) {
+        head->tree = insertTreeNode(head->tree, allocTreeNode(list->data));
+        list = getListEntry(list->next);
+      }
+
+      head->next = NoEntry;
+      head->count = 0;
+    }
+
+    uint32_t allocTreeNode(const T& slice) {
+      uint32_t index = uint32_t(m_tree.size());
+
+      // Treap priorities only need to be pseudo-random
+      uint32_t priority = index * 0x9E3779B9u;
+      priority ^= priority >> 15;
+      priority *= 0x2C1B3C6Du;
+      priority ^= priority >> 12;
+
+      TreeNode& node = m_tree.emplace_back();
+      node.data     = slice;
+      node.start    = slice.getRangeStart();
+      node.end      = slice.getRangeEnd();
+      node.maxEnd   = node.end;
+      node.access   = slice.getAccess();
+      node.priority = priority;
+      node.left     = NoEntry;
+      node.right    = NoEntry;
+      return index;
+    }
+
+    void updateTreeNode(uint32_t index) {
+      TreeNode& node = m_tree[index];
+      node.maxEnd = node.end;
+      node.access = node.data.getAccess();
+
+      if (node.left != NoEntry) {
+        node.maxEnd = std::max(node.maxEnd, m_tree[node.left].maxEnd);
+        node.access.set(m_tree[node.left].access);
+      }
+
+      if (node.right != NoEntry) {
+        node.maxEnd = std::max(node.maxEnd, m_tree[node.right].maxEnd);
+        node.access.set(m_tree[node.right].access);
+      }
+    }
+
+    void splitTree(uint32_t root, uint64_t start, uint32_t& lo, uint32_t& hi) {
+      if (root == NoEntry) {
+        lo = NoEntry;
+        hi = NoEntry;
+        return;
+      }
+
+      if (m_tree[root].start < start) {
+        uint32_t right = NoEntry;
+        splitTree(m_tree[root].right, start, right, hi);
+        m_tree[root].right = right;
+        lo = root;
+      } else {
+        uint32_t left = NoEntry;
+        splitTree(m_tree[root].left, start, lo, left);
+        m_tree[root].left = left;
+        hi = root;
+      }
+
+      updateTreeNode(root);
+    }
+
+    uint32_t insertTreeNode(uint32_t root, uint32_t node) {
+      if (root == NoEntry)
+        return node;
+
+      if (m_tree[node].priority > m_tree[root].priority) {
+        uint32_t lo = NoEntry;
+        uint32_t hi = NoEntry;
+        splitTree(root, m_tree[node].start, lo, hi);
+
+        m_tree[node].left = lo;
+        m_tree[node].right = hi;
+        updateTreeNode(node);
+        return node;
+      }
+
+      if (m_tree[node].start < m_tree[root].start) {
+        uint32_t left = insertTreeNode(m_tree[root].left, node);
+        m_tree[root].left = left;
+      } else {
+        uint32_t right = insertTreeNode(m_tree[root].right, node);
+        m_tree[root].right = right;
+      }
+
+      updateTreeNode(root);
+      return root;
+    }
+
+    void getTreeAccess(uint32_t index, const T& slice, DxvkAccessFlags& access) {
+      uint64_t start = slice.getRangeStart();
+      uint64_t end = slice.getRangeEnd();
+
+      while (index != NoEntry) {
+        const TreeNode& node = m_tree[index];
+
+        // Skip subtrees that cannot overlap the given
+        // slice or that cannot add any access flags
+        if (node.maxEnd <= start || (access | node.access) == access)
+          return;
+
+        getTreeAccess(node.left, slice, access);
+
+        if (node.start >= end)
+          return;
+
+        if (node.data.overlaps(slice))
+          access.set(node.data.getAccess());
+
+        index = node.right;
+      }
+    }
+
+    bool isTreeDirty(uint32_t index, const T& slice) {
+      uint64_t start = slice.getRangeStart();
+      uint64_t end = slice.getRangeEnd();
+
+      bool isWrite = slice.getAccess().test(DxvkAccess::Write);
+
+      while (index != NoEntry) {
+        const TreeNode& node = m_tree[index];
+
+        if (node.maxEnd <= start || !(isWrite || node.access.test(DxvkAccess::Write)))
+          return false;
+
+        if (isTreeDirty(node.left, slice))
+          return true;
+
+        if (node.start >= end)
+          return false;
+
+        if (node.data.isDirty(slice))
+          return true;
+
+        index = node.right;
+      }
+
+      return false;
+    }
+
   };
   
   /**
@@ -579,6 +786,24 @@ namespace dxvk {
     void finalize(
       const Rc<DxvkCommandList>&      commandList);
 
+    /**
+     * \brief Finalizes barrier set with an event
+     *
+     * Signals the given event instead of recording a pipeline
+     * barrier if the given dependency covers all pending barriers.
+     * Otherwise, the barriers get recorded as usual and the event
+     * is signaled afterwards, so that waits on it remain valid.
+     * \param [in] commandList Command list
+     * \param [in] event Event to signal
+     * \param [in] depInfo Dependency info, must only
+     *    contain a single global memory barrier
+     * \returns \c true if no pipeline barrier was recorded
+     */
+    bool finalizeSplit(
+      const Rc<DxvkCommandList>&      commandList,
+            VkEvent                   event,
+      const VkDependencyInfo&         depInfo);
+
     void recordCommands(
       const Rc<DxvkCommandList>&      commandList);
     
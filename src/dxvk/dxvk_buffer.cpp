@@ -5,17 +5,32 @@
 #include <algorithm>
 
 namespace dxvk {
-  
+
+  // Buffer usage that requires shader descriptors
+  constexpr VkBufferUsageFlags DescriptorUsage =
+    VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+    VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+    VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+
+
   DxvkBuffer::DxvkBuffer(
           DxvkDevice*           device,
     const DxvkBufferCreateInfo& createInfo,
           DxvkMemoryAllocator&  memAlloc,
+          DxvkBufferArena&      arena,
           VkMemoryPropertyFlags memFlags)
-  : m_vkd           (device->vkd()),
+  : m_device        (device),
+    m_vkd           (device->vkd()),
     m_info          (createInfo),
     m_memAlloc      (&memAlloc),
     m_memFlags      (memFlags),
     m_shaderStages  (util::shaderStages(createInfo.stages)) {
+    // Descriptor buffers need the address of any buffer that
+    // can be bound to shaders in order to write descriptors
+    if ((m_info.usage & DescriptorUsage) && device->canUseDescriptorBuffer())
+      m_info.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
     if (!(m_info.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT)) {
       // Align slices so that we don't violate any alignment
       // requirements imposed by the Vulkan device/driver
@@ -31,15 +46,28 @@ namespace dxvk {
         ? MaxBufferSize / m_physSliceStride
         : 1;
 
+      // Pack small buffers into shared arena pages. Backing
+      // buffers for renaming must fit into a single block.
+      if (DxvkBufferArena::isSupported(createInfo, sliceAlignment)) {
+        m_arena = &arena;
+
+        m_physSliceCount    = std::min(m_physSliceCount, DxvkBufferArena::MaxBlockSize / m_physSliceStride);
+        m_physSliceMaxCount = std::min(m_physSliceMaxCount, DxvkBufferArena::MaxBlockSize / m_physSliceStride);
+      }
+
+      m_physSliceMinCount = m_physSliceCount;
+      m_sliceTotalCount = m_physSliceCount;
+
       // Allocate the initial set of buffer slices. Only clear
       // buffer memory if there is more than one slice, since
       // we expect the client api to initialize the first slice.
       m_buffer = allocBuffer(m_physSliceCount, m_physSliceCount > 1);
 
       m_physSlice.handle = m_buffer.buffer;
-      m_physSlice.offset = 0;
+      m_physSlice.offset = m_buffer.offset;
       m_physSlice.length = m_physSliceLength;
-      m_physSlice.mapPtr = m_buffer.memory.mapPtr(0);
+      m_physSlice.mapPtr = m_buffer.mapPtr;
+      m_physSlice.gpuAddress = m_buffer.gpuAddress;
 
       m_lazyAlloc = m_physSliceCount > 1;
     } else {
@@ -54,6 +82,7 @@ namespace dxvk {
       m_physSlice.offset = 0;
       m_physSlice.length = createInfo.size;
       m_physSlice.mapPtr = nullptr;
+      m_physSlice.gpuAddress = m_buffer.gpuAddress;
 
       m_lazyAlloc = false;
 
@@ -67,7 +96,8 @@ namespace dxvk {
     const DxvkBufferCreateInfo& createInfo,
     const DxvkBufferImportInfo& importInfo,
           VkMemoryPropertyFlags memFlags)
-  : m_vkd           (device->vkd()),
+  : m_device        (device),
+    m_vkd           (device->vkd()),
     m_info          (createInfo),
     m_import        (importInfo),
     m_memAlloc      (nullptr),
@@ -83,19 +113,175 @@ namespace dxvk {
     m_physSlice.length = createInfo.size;
     m_physSlice.mapPtr = importInfo.mapPtr;
 
+    // We cannot add the device address usage to a buffer that was created
+    // externally, so shader descriptors for such buffers will be null.
+    VkDeviceAddress address = getBufferAddress(importInfo.buffer);
+
+    if (address) {
+      m_physSlice.gpuAddress = address + importInfo.offset;
+    } else if ((m_info.usage & DescriptorUsage) && device->canUseDescriptorBuffer()) {
+      Logger::err(str::format("DxvkBuffer: Imported buffer has no device address, usage: ",
+        std::hex, m_info.usage, ". Shaders will not be able to access it."));
+    }
+
     m_lazyAlloc = false;
   }
 
 
   DxvkBuffer::~DxvkBuffer() {
     for (const auto& buffer : m_buffers)
-      m_vkd->vkDestroyBuffer(m_vkd->device(), buffer.buffer, nullptr);
+      freeBuffer(buffer.handle);
+
+    freeBuffer(m_buffer);
+
+    if (m_renameMemory)
+      m_device->subStatCtr(DxvkStatCounter::BufferRenameMemory, m_renameMemory);
+  }
+
+
+  void DxvkBuffer::growSlicePool() {
+    // Size the new backing buffer so that it can satisfy the
+    // observed number of slices in flight, but keep growing
+    // geometrically if the demand exceeds our estimate.
+    VkDeviceSize sliceCount = m_physSliceCount;
+
+    if (m_sliceDemand > m_sliceTotalCount)
+      sliceCount = std::max<VkDeviceSize>(sliceCount, m_sliceDemand - m_sliceTotalCount);
+
+    sliceCount = std::min(sliceCount, m_physSliceMaxCount);
+
+    SliceBuffer buffer;
+    buffer.handle = allocBuffer(sliceCount, true);
+    buffer.sliceCount = uint32_t(sliceCount);
+
+    for (uint32_t i = 0; i < buffer.sliceCount; i++)
+      pushSlice(buffer.handle, i);
+
+    VkDeviceSize memorySize = m_physSliceStride * sliceCount;
+
+    m_buffers.push_back(std::move(buffer));
+    m_physSliceCount = std::min(sliceCount * 2, m_physSliceMaxCount);
+    m_sliceTotalCount += uint32_t(sliceCount);
+    m_sliceAllocCount = 0;
+
+    m_renameMemory += memorySize;
+    m_device->addStatCtr(DxvkStatCounter::BufferRenameMemory, memorySize);
+  }
+
+
+  void DxvkBuffer::trimSlicePool() {
+    m_sliceAllocCount = 0;
+
+    // Gather all slices that have been returned so far,
+    // everything else is in use by the GPU or the client.
+    { std::unique_lock<sync::Spinlock> swapLock(m_swapMutex);
+      m_freeSlices.insert(m_freeSlices.end(), m_nextSlices.begin(), m_nextSlices.end());
+      m_nextSlices.clear();
+    }
+
+    uint32_t sliceInUseCount = m_sliceTotalCount - m_freeSlices.size();
+
+    // Let the demand estimate decay slowly so that short bursts
+    // do not immediately trigger a trim. Round the decay step up
+    // so that small estimates can still drop to the actual usage.
+    m_sliceDemand -= (m_sliceDemand + 3) / 4;
+    m_sliceDemand = std::max(m_sliceDemand, sliceInUseCount);
+
+    // Buffer views cache Vulkan views per slice, and those
+    // caches do not expect backing buffers to go away.
+    if (m_buffers.empty() || (m_info.usage & (
+          VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+          VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT)))
+      return;
+
+    // Count free slices per backing buffer. Buffers where all
+    // slices are free are not referenced by anything anymore.
+    small_vector<uint32_t, 16> freeCounts;
+    freeCounts.resize(m_buffers.size());
+
+    for (const auto& slice : m_freeSlices) {
+      for (size_t i = 0; i < m_buffers.size(); i++) {
+        if (ownsSlice(m_buffers[i], slice)) {
+          freeCounts[i] += 1;
+          break;
+        }
+      }
+    }
+
+    // Release idle backing buffers, newest and largest first,
+    // while keeping twice the observed demand around.
+    small_vector<bool, 16> released;
+    released.resize(m_buffers.size());
+
+    VkDeviceSize releasedMemory = 0;
+
+    for (size_t i = m_buffers.size(); i; i--) {
+      const auto& buffer = m_buffers[i - 1];
+
+      if (freeCounts[i - 1] != buffer.sliceCount
+       || m_sliceTotalCount - buffer.sliceCount < 2 * m_sliceDemand)
+        continue;
+
+      released[i - 1] = true;
+      releasedMemory += m_physSliceStride * buffer.sliceCount;
+      m_sliceTotalCount -= buffer.sliceCount;
+    }
+
+    if (!releasedMemory)
+      return;
+
+    // Arena-backed buffers share their Vulkan buffer
+    // with other resources, so check the slice range.
+    m_freeSlices.erase(std::remove_if(m_freeSlices.begin(), m_freeSlices.end(),
+      [this, &released] (const DxvkBufferSliceHandle& slice) {
+        for (size_t i = 0; i < m_buffers.size(); i++) {
+          if (released[i] && ownsSlice(m_buffers[i], slice))
+            return true;
+        }
+
+        return false;
+      }), m_freeSlices.end());
+
+    size_t bufferCount = 0;
 
-    m_vkd->vkDestroyBuffer(m_vkd->device(), m_buffer.buffer, nullptr);
+    for (size_t i = 0; i < m_buffers.size(); i++) {
+      if (released[i]) {
+        freeBuffer(m_buffers[i].handle);
+        continue;
+      }
+
+      if (bufferCount != i)
+        m_buffers[bufferCount] = std::move(m_buffers[i]);
+
+      bufferCount += 1;
+    }
+
+    m_buffers.resize(bufferCount);
+
+    // Start growing from a size matching the current demand again
+    m_physSliceCount = std::clamp<VkDeviceSize>(m_sliceDemand,
+      m_physSliceMinCount, m_physSliceMaxCount);
+
+    m_renameMemory -= releasedMemory;
+    m_device->subStatCtr(DxvkStatCounter::BufferRenameMemory, releasedMemory);
   }
   
   
   DxvkBufferHandle DxvkBuffer::allocBuffer(VkDeviceSize sliceCount, bool clear) const {
+    if (m_arena) {
+      DxvkBufferHandle handle = m_arena->alloc(m_info.usage,
+        m_memFlags, getMemoryHints(), m_physSliceStride * sliceCount);
+
+      // If the arena could not allocate a page, fall back to
+      // a regular buffer. These are freed based on the memory.
+      if (handle.buffer) {
+        if (clear && (m_memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+          std::memset(handle.mapPtr, 0, m_physSliceStride * sliceCount);
+
+        return handle;
+      }
+    }
+
     VkBufferCreateInfo info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
     info.flags = m_info.flags;
     info.size = m_physSliceStride * sliceCount;
@@ -133,6 +319,31 @@ namespace dxvk {
       memoryProperties.dedicated.buffer = handle.buffer;
     }
 
+    DxvkMemoryFlags hints = getMemoryHints();
+
+    memoryProperties.tag.type   = hints.test(DxvkMemoryFlag::Transient)
+      ? DxvkMemoryTagType::Staging
+      : DxvkMemoryTagType::Buffer;
+    memoryProperties.tag.usage  = m_info.usage;
+    memoryProperties.tag.object = this;
+
+    handle.memory = m_memAlloc->alloc(memoryRequirements, memoryProperties, hints);
+    
+    if (m_vkd->vkBindBufferMemory(m_vkd->device(), handle.buffer,
+        handle.memory.memory(), handle.memory.offset()) != VK_SUCCESS)
+      throw DxvkError("DxvkBuffer: Failed to bind device memory");
+    
+    handle.mapPtr = handle.memory.mapPtr(0);
+    handle.gpuAddress = getBufferAddress(handle.buffer);
+
+    if (clear && (m_memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+      std::memset(handle.mapPtr, 0, info.size);
+
+    return handle;
+  }
+
+
+  DxvkMemoryFlags DxvkBuffer::getMemoryHints() const {
     // Use high memory priority for GPU-writable resources
     bool isGpuWritable = (m_info.access & (
       VK_ACCESS_SHADER_WRITE_BIT |
@@ -143,6 +354,9 @@ namespace dxvk {
     if (isGpuWritable)
       hints.set(DxvkMemoryFlag::GpuWritable);
 
+    if (m_info.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+      hints.set(DxvkMemoryFlag::DeviceAddress);
+
     // Staging buffers that can't even be used as a transfer destinations
     // are likely short-lived, so we should put them on a separate memory
     // pool in order to avoid fragmentation
@@ -150,16 +364,16 @@ namespace dxvk {
      && (m_info.usage & VK_BUFFER_USAGE_TRANSFER_SRC_BIT))
       hints.set(DxvkMemoryFlag::Transient);
 
-    handle.memory = m_memAlloc->alloc(memoryRequirements, memoryProperties, hints);
-    
-    if (m_vkd->vkBindBufferMemory(m_vkd->device(), handle.buffer,
-        handle.memory.memory(), handle.memory.offset()) != VK_SUCCESS)
-      throw DxvkError("DxvkBuffer: Failed to bind device memory");
-    
-    if (clear && (m_memFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
-      std::memset(handle.memory.mapPtr(0), 0, info.size);
+    return hints;
+  }
 
-    return handle;
+
+  void DxvkBuffer::freeBuffer(const DxvkBufferHandle& buffer) const {
+    // Arena blocks do not own any memory themselves
+    if (m_arena && !buffer.memory)
+      m_arena->free(buffer);
+    else
+      m_vkd->vkDestroyBuffer(m_vkd->device(), buffer.buffer, nullptr);
   }
 
 
@@ -181,10 +395,23 @@ namespace dxvk {
         "\n  usage: ", std::hex, info.usage));
     }
 
+    handle.gpuAddress = getBufferAddress(handle.buffer);
     return handle;
   }
 
 
+  VkDeviceAddress DxvkBuffer::getBufferAddress(
+          VkBuffer              buffer) const {
+    if (!(m_info.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT))
+      return 0;
+
+    VkBufferDeviceAddressInfo addressInfo = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+    addressInfo.buffer = buffer;
+
+    return m_vkd->vkGetBufferDeviceAddress(m_vkd->device(), &addressInfo);
+  }
+
+
   VkDeviceSize DxvkBuffer::computeSliceAlignment(DxvkDevice* device) const {
     const auto& devInfo = device->properties();
 
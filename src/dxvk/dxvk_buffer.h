@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "dxvk_buffer_arena.h"
 #include "dxvk_descriptor.h"
 #include "dxvk_format.h"
 #include "dxvk_hash.h"
@@ -76,10 +77,16 @@ namespace dxvk {
    * 
    * Stores a Vulkan buffer handle and the
    * memory object that is bound to the buffer.
+   * For buffers allocated from an arena, the
+   * memory is owned by the arena instead, and
+   * the buffer range starts at the given offset.
    */
   struct DxvkBufferHandle {
     VkBuffer      buffer = VK_NULL_HANDLE;
     DxvkMemory    memory;
+    VkDeviceSize  offset = 0;
+    void*         mapPtr = nullptr;
+    VkDeviceAddress gpuAddress = 0;
   };
   
 
@@ -95,6 +102,7 @@ namespace dxvk {
     VkDeviceSize  offset;
     VkDeviceSize  length;
     void*         mapPtr;
+    VkDeviceAddress gpuAddress;
 
     bool eq(const DxvkBufferSliceHandle& other) const {
       return handle == other.handle
@@ -127,6 +135,7 @@ namespace dxvk {
             DxvkDevice*           device,
       const DxvkBufferCreateInfo& createInfo,
             DxvkMemoryAllocator&  memAlloc,
+            DxvkBufferArena&      arena,
             VkMemoryPropertyFlags memFlags);
 
     DxvkBuffer(
@@ -200,6 +209,7 @@ namespace dxvk {
       result.offset = m_physSlice.offset + offset;
       result.length = length;
       result.mapPtr = mapPtr(offset);
+      result.gpuAddress = m_physSlice.gpuAddress + offset;
       return result;
     }
 
@@ -218,6 +228,23 @@ namespace dxvk {
       return result;
     }
 
+    /**
+     * \brief Retrieves descriptor address info
+     *
+     * Used to write buffer descriptors to descriptor
+     * buffers. Only valid if the buffer was created
+     * with shader device address usage.
+     * \param [in] offset Buffer slice offset
+     * \param [in] length Buffer slice length
+     * \returns Buffer slice address info
+     */
+    VkDescriptorAddressInfoEXT getAddressInfo(VkDeviceSize offset, VkDeviceSize length) const {
+      VkDescriptorAddressInfoEXT result = { VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT };
+      result.address = m_physSlice.gpuAddress + offset;
+      result.range = length;
+      return result;
+    }
+
     /**
      * \brief Retrieves dynamic offset
      * 
@@ -275,25 +302,26 @@ namespace dxvk {
       if (unlikely(m_freeSlices.empty())) {
         std::unique_lock<sync::Spinlock> swapLock(m_swapMutex);
         std::swap(m_freeSlices, m_nextSlices);
+
+        // Every slice that is not on the free list at
+        // this point is still in use by the GPU.
+        m_sliceDemand = std::max(m_sliceDemand,
+          uint32_t(m_sliceTotalCount - m_freeSlices.size()));
       }
 
       // If there are still no slices available, create a new
       // backing buffer and add all slices to the free list.
       if (unlikely(m_freeSlices.empty())) {
         if (likely(!m_lazyAlloc)) {
-          DxvkBufferHandle handle = allocBuffer(m_physSliceCount, true);
-
-          for (uint32_t i = 0; i < m_physSliceCount; i++)
-            pushSlice(handle, i);
-
-          m_buffers.push_back(std::move(handle));
-          m_physSliceCount = std::min(m_physSliceCount * 2, m_physSliceMaxCount);
+          growSlicePool();
         } else {
           for (uint32_t i = 1; i < m_physSliceCount; i++)
             pushSlice(m_buffer, i);
 
           m_lazyAlloc = false;
         }
+      } else if (unlikely(++m_sliceAllocCount >= SliceTrimInterval)) {
+        trimSlicePool();
       }
       
       // Take the first slice from the queue
@@ -326,10 +354,19 @@ namespace dxvk {
 
   private:
 
+    constexpr static uint32_t SliceTrimInterval = 256;
+
+    struct SliceBuffer {
+      DxvkBufferHandle      handle;
+      uint32_t              sliceCount;
+    };
+
+    DxvkDevice*             m_device;
     Rc<vk::DeviceFn>        m_vkd;
     DxvkBufferCreateInfo    m_info;
     DxvkBufferImportInfo    m_import;
     DxvkMemoryAllocator*    m_memAlloc;
+    DxvkBufferArena*        m_arena = nullptr;
     VkMemoryPropertyFlags   m_memFlags;
     VkShaderStageFlags      m_shaderStages;
     
@@ -345,29 +382,54 @@ namespace dxvk {
     VkDeviceSize            m_physSliceStride   = 0;
     VkDeviceSize            m_physSliceCount    = 1;
     VkDeviceSize            m_physSliceMaxCount = 1;
+    VkDeviceSize            m_physSliceMinCount = 1;
 
-    std::vector<DxvkBufferHandle>       m_buffers;
+    uint32_t                m_sliceTotalCount = 1;
+    uint32_t                m_sliceDemand     = 0;
+    uint32_t                m_sliceAllocCount = 0;
+    VkDeviceSize            m_renameMemory    = 0;
+
+    std::vector<SliceBuffer>            m_buffers;
     std::vector<DxvkBufferSliceHandle>  m_freeSlices;
 
     alignas(CACHE_LINE_SIZE)
     sync::Spinlock                      m_swapMutex;
     std::vector<DxvkBufferSliceHandle>  m_nextSlices;
 
-    void pushSlice(const DxvkBufferHandle& handle, uint32_t index) {
+    void pushSlice(const DxvkBufferHandle& buffer, uint32_t index) {
       DxvkBufferSliceHandle slice;
-      slice.handle = handle.buffer;
+      slice.handle = buffer.buffer;
       slice.length = m_physSliceLength;
-      slice.offset = m_physSliceStride * index;
-      slice.mapPtr = handle.memory.mapPtr(slice.offset);
+      slice.offset = buffer.offset + m_physSliceStride * index;
+      slice.mapPtr = reinterpret_cast<char*>(buffer.mapPtr) + m_physSliceStride * index;
+      slice.gpuAddress = buffer.gpuAddress + m_physSliceStride * index;
       m_freeSlices.push_back(slice);
     }
 
+    bool ownsSlice(const SliceBuffer& buffer, const DxvkBufferSliceHandle& slice) const {
+      return buffer.handle.buffer == slice.handle
+          && buffer.handle.offset <= slice.offset
+          && buffer.handle.offset + m_physSliceStride * buffer.sliceCount > slice.offset;
+    }
+
+    void growSlicePool();
+
+    void trimSlicePool();
+
     DxvkBufferHandle allocBuffer(
             VkDeviceSize          sliceCount,
             bool                  clear) const;
 
+    DxvkMemoryFlags getMemoryHints() const;
+
+    void freeBuffer(
+      const DxvkBufferHandle&     buffer) const;
+
     DxvkBufferHandle createSparseBuffer() const;
 
+    VkDeviceAddress getBufferAddress(
+            VkBuffer              buffer) const;
+
     VkDeviceSize computeSliceAlignment(
             DxvkDevice*           device) const;
     
@@ -495,6 +557,14 @@ namespace dxvk {
       return m_buffer->getDescriptor(m_offset, m_length);
     }
 
+    /**
+     * \brief Retrieves descriptor address info
+     * \returns Buffer slice address info
+     */
+    VkDescriptorAddressInfoEXT getAddressInfo() const {
+      return m_buffer->getAddressInfo(m_offset, m_length);
+    }
+
     /**
      * \brief Retrieves dynamic offset
      * 
@@ -668,6 +738,22 @@ namespace dxvk {
         m_info.rangeLength);
     }
     
+    /**
+     * \brief Retrieves descriptor address info
+     *
+     * Used to write texel buffer descriptors to descriptor
+     * buffers. The view must be up to date, so this must
+     * only be called after \ref updateView.
+     * \returns Address, range and format of the view
+     */
+    VkDescriptorAddressInfoEXT getAddressInfo() const {
+      VkDescriptorAddressInfoEXT result = { VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT };
+      result.address = m_bufferSlice.gpuAddress;
+      result.range = m_bufferSlice.length;
+      result.format = m_info.format;
+      return result;
+    }
+
     /**
      * \brief Updates the buffer view
      * 
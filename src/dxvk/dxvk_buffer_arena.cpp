@@ -0,0 +1,241 @@
+#include "dxvk_buffer.h"
+#include "dxvk_buffer_arena.h"
+#include "dxvk_device.h"
+
+namespace dxvk {
+
+  DxvkBufferArena::DxvkBufferArena(
+          DxvkDevice*           device,
+          DxvkMemoryAllocator&  memAlloc)
+  : m_device    (device),
+    m_vkd       (device->vkd()),
+    m_memAlloc  (&memAlloc) {
+
+  }
+
+
+  DxvkBufferArena::~DxvkBufferArena() {
+    for (const auto& entry : m_pages) {
+      m_vkd->vkDestroyBuffer(m_vkd->device(), entry.second->buffer, nullptr);
+      delete entry.second;
+    }
+  }
+
+
+  bool DxvkBufferArena::isSupported(
+    const DxvkBufferCreateInfo& info,
+          VkDeviceSize          sliceAlignment) {
+    // Buffer views and shader writes would require tracking
+    // that is not worth it for this kind of buffer anyway
+    constexpr VkBufferUsageFlags supportedUsage =
+      VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+      VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+      VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+      VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+      VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+    return !info.flags
+        && !(info.usage & ~supportedUsage)
+        && (info.usage & ~(VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+        && (info.size <= MaxBlockSize)
+        && (sliceAlignment <= MinBlockSize);
+  }
+
+
+  DxvkBufferHandle DxvkBufferArena::alloc(
+          VkBufferUsageFlags    usage,
+          VkMemoryPropertyFlags memFlags,
+          DxvkMemoryFlags       hints,
+          VkDeviceSize          size) {
+    std::lock_guard<dxvk::mutex> lock(m_mutex);
+
+    uint32_t poolIndex = getPool(usage, memFlags, hints);
+    uint32_t sizeClass = getSizeClass(size);
+
+    // Use the most recently created page with free blocks,
+    // since older pages are more likely to become empty
+    auto& pages = m_pools[poolIndex].pages[sizeClass];
+    Page* page = nullptr;
+
+    for (size_t i = pages.size(); i && !page; i--) {
+      if (!pages[i - 1]->freeBlocks.empty())
+        page = pages[i - 1];
+    }
+
+    if (!page)
+      page = createPage(poolIndex, sizeClass);
+
+    if (!page)
+      return DxvkBufferHandle();
+
+    uint32_t block = page->freeBlocks.back();
+    page->freeBlocks.pop_back();
+
+    VkDeviceSize blockSize = MinBlockSize << sizeClass;
+
+    DxvkBufferHandle result;
+    result.buffer = page->buffer;
+    result.offset = blockSize * block;
+    result.mapPtr = page->memory.mapPtr(result.offset);
+
+    if (page->gpuAddress)
+      result.gpuAddress = page->gpuAddress + result.offset;
+
+    return result;
+  }
+
+
+  void DxvkBufferArena::free(
+    const DxvkBufferHandle&     handle) {
+    std::lock_guard<dxvk::mutex> lock(m_mutex);
+
+    auto entry = m_pages.find(handle.buffer);
+
+    if (entry == m_pages.end())
+      return;
+
+    Page* page = entry->second;
+    page->freeBlocks.push_back(handle.offset / (MinBlockSize << page->sizeClass));
+
+    if (page->freeBlocks.size() < page->blockCount)
+      return;
+
+    // Keep one empty page per size class around so that
+    // buffers that get recreated a lot don't cause churn
+    auto& pages = m_pools[page->pool].pages[page->sizeClass];
+    uint32_t emptyCount = 0;
+
+    for (const Page* p : pages)
+      emptyCount += p->freeBlocks.size() == p->blockCount ? 1 : 0;
+
+    if (emptyCount > 1)
+      destroyPage(page);
+  }
+
+
+  uint32_t DxvkBufferArena::getPool(
+          VkBufferUsageFlags    usage,
+          VkMemoryPropertyFlags memFlags,
+          DxvkMemoryFlags       hints) {
+    for (uint32_t i = 0; i < m_pools.size(); i++) {
+      if (m_pools[i].usage == usage && m_pools[i].memFlags == memFlags && m_pools[i].hints.raw() == hints.raw())
+        return i;
+    }
+
+    Pool& pool = m_pools.emplace_back();
+    pool.usage    = usage;
+    pool.memFlags = memFlags;
+    pool.hints    = hints;
+    return m_pools.size() - 1;
+  }
+
+
+  DxvkBufferArena::Page* DxvkBufferArena::createPage(
+          uint32_t              pool,
+          uint32_t              sizeClass) {
+    const Pool& poolInfo = m_pools[pool];
+
+    VkBufferCreateInfo info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    info.size = PageSize;
+    info.usage = poolInfo.usage;
+    info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkBuffer buffer = VK_NULL_HANDLE;
+
+    if (m_vkd->vkCreateBuffer(m_vkd->device(), &info, nullptr, &buffer)) {
+      throw DxvkError(str::format(
+        "DxvkBufferArena: Failed to create buffer:"
+        "\n  size:  ", std::dec, info.size,
+        "\n  usage: ", std::hex, info.usage));
+    }
+
+    DxvkMemoryRequirements memoryRequirements = { };
+    memoryRequirements.tiling = VK_IMAGE_TILING_LINEAR;
+    memoryRequirements.dedicated = { VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS };
+    memoryRequirements.core = { VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2, &memoryRequirements.dedicated };
+
+    VkBufferMemoryRequirementsInfo2 memoryRequirementInfo = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2 };
+    memoryRequirementInfo.buffer = buffer;
+
+    m_vkd->vkGetBufferMemoryRequirements2(m_vkd->device(),
+      &memoryRequirementInfo, &memoryRequirements.core);
+
+    DxvkMemoryProperties memoryProperties = { };
+    memoryProperties.flags = poolInfo.memFlags;
+    memoryProperties.tag.type   = DxvkMemoryTagType::Buffer;
+    memoryProperties.tag.usage  = poolInfo.usage;
+    memoryProperties.tag.object = this;
+
+    // Let the caller fall back to a regular buffer if no memory
+    // that satisfies the requirements of the pool is available
+    DxvkMemory memory;
+
+    try {
+      memory = m_memAlloc->alloc(memoryRequirements, memoryProperties, poolInfo.hints);
+    } catch (const DxvkError& e) {
+      Logger::warn("DxvkBufferArena: Failed to allocate page, using regular buffer");
+      Logger::warn(e.message());
+
+      m_vkd->vkDestroyBuffer(m_vkd->device(), buffer, nullptr);
+      return nullptr;
+    }
+
+    Page* page = new Page();
+    page->buffer     = buffer;
+    page->memory     = std::move(memory);
+    page->pool       = pool;
+    page->sizeClass  = sizeClass;
+    page->blockCount = uint32_t(PageSize / (MinBlockSize << sizeClass));
+
+    if (m_vkd->vkBindBufferMemory(m_vkd->device(), buffer,
+        page->memory.memory(), page->memory.offset()) != VK_SUCCESS)
+      throw DxvkError("DxvkBufferArena: Failed to bind device memory");
+
+    if (poolInfo.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) {
+      VkBufferDeviceAddressInfo addressInfo = { VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO };
+      addressInfo.buffer = buffer;
+
+      page->gpuAddress = m_vkd->vkGetBufferDeviceAddress(m_vkd->device(), &addressInfo);
+    }
+
+    // Hand out blocks in ascending order
+    page->freeBlocks.resize(page->blockCount);
+
+    for (uint32_t i = 0; i < page->blockCount; i++)
+      page->freeBlocks[i] = page->blockCount - i - 1;
+
+    m_pools[pool].pages[sizeClass].push_back(page);
+    m_pages.insert({ buffer, page });
+    return page;
+  }
+
+
+  void DxvkBufferArena::destroyPage(
+          Page*                 page) {
+    auto& pages = m_pools[page->pool].pages[page->sizeClass];
+
+    for (size_t i = 0; i < pages.size(); i++) {
+      if (pages[i] == page) {
+        pages.erase(pages.begin() + i);
+        break;
+      }
+    }
+
+    m_pages.erase(page->buffer);
+    m_vkd->vkDestroyBuffer(m_vkd->device(), page->buffer, nullptr);
+    delete page;
+  }
+
+
+  uint32_t DxvkBufferArena::getSizeClass(
+          VkDeviceSize          size) {
+    uint32_t sizeClass = 0;
+
+    while ((MinBlockSize << sizeClass) < size)
+      sizeClass += 1;
+
+    return sizeClass;
+  }
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "dxvk_memory.h"
+
+namespace dxvk {
+
+  class DxvkDevice;
+
+  struct DxvkBufferCreateInfo;
+  struct DxvkBufferHandle;
+
+  /**
+   * \brief Buffer arena
+   *
+   * Packs small buffers into shared Vulkan buffers in order to
+   * reduce the number of buffer objects and memory allocations.
+   * Memory is handed out in power-of-two sized blocks, and each
+   * size class uses its own set of pages.
+   */
+  class DxvkBufferArena {
+    constexpr static uint32_t SizeClassCount = 7;
+  public:
+
+    /// Smallest block size. This satisfies any
+    /// offset alignment requirement for buffers.
+    constexpr static VkDeviceSize MinBlockSize = 256;
+
+    /// Largest block size
+    constexpr static VkDeviceSize MaxBlockSize = MinBlockSize << (SizeClassCount - 1);
+
+    /// Size of a single page
+    constexpr static VkDeviceSize PageSize = 256 << 10;
+
+    DxvkBufferArena(
+            DxvkDevice*           device,
+            DxvkMemoryAllocator&  memAlloc);
+
+    ~DxvkBufferArena();
+
+    /**
+     * \brief Checks whether a buffer can use the arena
+     *
+     * Only applies to buffers that are not used with buffer
+     * views or for shader writes, and which are small enough
+     * that sharing a Vulkan buffer is worth it.
+     * \param [in] info Buffer create info
+     * \param [in] sliceAlignment Required slice alignment
+     * \returns \c true if the buffer can use the arena
+     */
+    static bool isSupported(
+      const DxvkBufferCreateInfo& info,
+            VkDeviceSize          sliceAlignment);
+
+    /**
+     * \brief Allocates a block
+     *
+     * The returned handle does not own any memory, and
+     * must be returned to the arena via \ref free.
+     * \param [in] usage Buffer usage flags
+     * \param [in] memFlags Memory property flags
+     * \param [in] hints Memory hints of the buffer
+     * \param [in] size Number of bytes to allocate
+     * \returns Buffer handle with offset, or a null
+     *    handle if no page could be allocated
+     */
+    DxvkBufferHandle alloc(
+            VkBufferUsageFlags    usage,
+            VkMemoryPropertyFlags memFlags,
+            DxvkMemoryFlags       hints,
+            VkDeviceSize          size);
+
+    /**
+     * \brief Frees a block
+     *
+     * Must only be called once the GPU has
+     * stopped using the memory in question.
+     * \param [in] handle Handle returned by \ref alloc
+     */
+    void free(
+      const DxvkBufferHandle&     handle);
+
+  private:
+
+    struct Page {
+      VkBuffer              buffer;
+      DxvkMemory            memory;
+      uint32_t              pool;
+      uint32_t              sizeClass;
+      uint32_t              blockCount;
+      std::vector<uint32_t> freeBlocks;
+      VkDeviceAddress       gpuAddress = 0;
+    };
+
+    struct Pool {
+      VkBufferUsageFlags    usage;
+      VkMemoryPropertyFlags memFlags;
+      DxvkMemoryFlags       hints;
+      std::array<std::vector<Page*>, SizeClassCount> pages;
+    };
+
+    DxvkDevice*           m_device;
+    Rc<vk::DeviceFn>      m_vkd;
+    DxvkMemoryAllocator*  m_memAlloc;
+
+    dxvk::mutex           m_mutex;
+    std::vector<Pool>     m_pools;
+
+    std::unordered_map<VkBuffer, Page*> m_pages;
+
+    uint32_t getPool(
+            VkBufferUsageFlags    usage,
+            VkMemoryPropertyFlags memFlags,
+            DxvkMemoryFlags       hints);
+
+    Page* createPage(
+            uint32_t              pool,
+            uint32_t              sizeClass);
+
+    void destroyPage(
+            Page*                 page);
+
+    static uint32_t getSizeClass(
+            VkDeviceSize          size);
+
+  };
+
+}
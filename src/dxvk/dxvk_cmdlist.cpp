@@ -250,19 +250,27 @@ namespace dxvk {
         m_commandSubmission.waitSemaphore(m_postSemaphore, 0, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
       }
 
-      // Submit transfer commands as necessary
-      if (cmd.usedFlags.test(DxvkCmdBuffer::SdmaBuffer))
-        m_commandSubmission.executeCommandBuffer(cmd.sdmaBuffer);
+      if (m_asyncTransferValue) {
+        // Transfer commands have already been submitted
+        if (isFirst) {
+          m_commandSubmission.waitSemaphore(m_asyncTransferSemaphore,
+            m_asyncTransferValue, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+        }
+      } else {
+        // Submit transfer commands as necessary
+        if (cmd.usedFlags.test(DxvkCmdBuffer::SdmaBuffer))
+          m_commandSubmission.executeCommandBuffer(cmd.sdmaBuffer);
 
-      // If we had either a transfer command or a semaphore wait, submit to the
-      // transfer queue so that all subsequent commands get stalled as necessary.
-      if (m_device->hasDedicatedTransferQueue() && !m_commandSubmission.isEmpty()) {
-        m_commandSubmission.signalSemaphore(m_sdmaSemaphore, 0, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT);
+        // If we had either a transfer command or a semaphore wait, submit to the
+        // transfer queue so that all subsequent commands get stalled as necessary.
+        if (m_device->hasDedicatedTransferQueue() && !m_commandSubmission.isEmpty()) {
+          m_commandSubmission.signalSemaphore(m_sdmaSemaphore, 0, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT);
 
-        if ((status = m_commandSubmission.submit(m_device, transfer.queueHandle)))
-          return status;
+          if ((status = m_commandSubmission.submit(m_device, transfer.queueHandle)))
+            return status;
 
-        m_commandSubmission.waitSemaphore(m_sdmaSemaphore, 0, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+          m_commandSubmission.waitSemaphore(m_sdmaSemaphore, 0, VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT);
+        }
       }
 
       // We promise to never do weird stuff to WSI images on
@@ -305,8 +313,52 @@ namespace dxvk {
   }
   
   
+  bool DxvkCommandList::isAsyncTransfer() const {
+    if (!m_asyncTransferId || !m_device->hasDedicatedTransferQueue())
+      return false;
+
+    // Any other semaphore wait or sparse binding operation would
+    // have to be ordered before the transfer commands as well
+    if (!m_waitSemaphores.empty() || !m_cmdSparseBinds.empty() || m_wsiSemaphores.acquire)
+      return false;
+
+    for (const auto& cmd : m_cmdSubmissions) {
+      if (cmd.usedFlags.test(DxvkCmdBuffer::SdmaBuffer))
+        return true;
+    }
+
+    return false;
+  }
+
+
+  VkResult DxvkCommandList::submitAsyncTransfer(
+          VkSemaphore               semaphore,
+          uint64_t                  value) {
+    const auto& transfer = m_device->queues().transfer;
+
+    m_commandSubmission.reset();
+
+    for (const auto& cmd : m_cmdSubmissions) {
+      if (cmd.usedFlags.test(DxvkCmdBuffer::SdmaBuffer))
+        m_commandSubmission.executeCommandBuffer(cmd.sdmaBuffer);
+    }
+
+    m_commandSubmission.signalSemaphore(semaphore, value, VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT);
+
+    VkResult status = m_commandSubmission.submit(m_device, transfer.queueHandle);
+
+    if (status == VK_SUCCESS) {
+      m_asyncTransferSemaphore = semaphore;
+      m_asyncTransferValue = value;
+    }
+
+    return status;
+  }
+
+
   void DxvkCommandList::init() {
     m_cmd = DxvkCommandSubmissionInfo();
+    m_submissionId = allocSubmissionId();
 
     // Grab a fresh set of command buffers from the pools
     m_cmd.execBuffer = m_graphicsPool->getCommandBuffer();
@@ -355,6 +407,7 @@ namespace dxvk {
     }
 
     m_cmd.usedFlags = 0;
+    m_submissionId = allocSubmissionId();
   }
 
   
@@ -385,6 +438,11 @@ namespace dxvk {
 
     m_descriptorPools.clear();
 
+    for (const auto& descriptorBuffers : m_descriptorBuffers)
+      descriptorBuffers.second->recycleDescriptorBuffer(descriptorBuffers.first);
+
+    m_descriptorBuffers.clear();
+
     // Release pipelines
     for (auto pipeline : m_pipelines)
       pipeline->releasePipeline();
@@ -399,6 +457,11 @@ namespace dxvk {
 
     m_wsiSemaphores = PresenterSync();
 
+    m_asyncTransferId = 0;
+    m_asyncTransferDeps = 0;
+    m_asyncTransferValue = 0;
+    m_asyncTransferSemaphore = VK_NULL_HANDLE;
+
     // Reset actual command buffers and pools
     m_graphicsPool->reset();
     m_transferPool->reset();
@@ -409,6 +472,12 @@ namespace dxvk {
   }
 
 
+  uint64_t DxvkCommandList::allocSubmissionId() {
+    static std::atomic<uint64_t> s_submissionId = { 0ull };
+    return ++s_submissionId;
+  }
+
+
   void DxvkCommandList::endCommandBuffer(VkCommandBuffer cmdBuffer) {
     auto vk = m_device->vkd();
 
@@ -5,6 +5,7 @@
 #include "dxvk_bind_mask.h"
 #include "dxvk_buffer.h"
 #include "dxvk_descriptor.h"
+#include "dxvk_descriptor_buffer.h"
 #include "dxvk_fence.h"
 #include "dxvk_gpu_event.h"
 #include "dxvk_gpu_query.h"
@@ -200,6 +201,21 @@ namespace dxvk {
      * \returns Submission status
      */
     VkResult submit();
+
+    /**
+     * \brief Submits transfer commands
+     *
+     * Submits all transfer queue commands of the command list
+     * and signals the given timeline semaphore. A subsequent
+     * call to \ref submit will only submit graphics commands
+     * and wait for the semaphore before executing them.
+     * \param [in] semaphore Timeline semaphore
+     * \param [in] value Semaphore value to signal
+     * \returns Submission status
+     */
+    VkResult submitAsyncTransfer(
+            VkSemaphore               semaphore,
+            uint64_t                  value);
     
     /**
      * \brief Stat counters
@@ -273,8 +289,89 @@ namespace dxvk {
      */
     template<DxvkAccess Access, typename T>
     void trackResource(const Rc<T>& rc) {
+      m_asyncTransferDeps = std::max(m_asyncTransferDeps, rc->getAsyncTransfer());
+
+      if (unlikely(m_asyncTransferId))
+        rc->trackAsyncTransfer(m_asyncTransferId);
+
+      // Resources tend to be used many times per submission, so
+      // avoid redundant reference count updates and list entries
+      if (rc->isTrackedBySubmission(m_submissionId, Access))
+        return;
+
+      rc->trackSubmission(m_submissionId, Access);
       m_resources.trackResource<Access>(rc.ptr());
     }
+
+    /**
+     * \brief Queries current submission ID
+     *
+     * Unique for each set of command buffers, i.e. this
+     * changes whenever \ref next is called. Resources
+     * can be checked against this ID to find out whether
+     * the current submission uses them.
+     * \returns Submission ID
+     */
+    uint64_t getSubmissionId() const {
+      return m_submissionId;
+    }
+
+    /**
+     * \brief Enables async transfers
+     *
+     * Transfer commands of this command list may be
+     * submitted ahead of time, and the remaining work
+     * gets deferred until any later submission uses
+     * one of the resources tracked by this command
+     * list. Must be called before recording commands.
+     */
+    void enableAsyncTransfer() {
+      m_asyncTransferId = m_submissionId;
+    }
+
+    /**
+     * \brief Checks whether transfers can be submitted early
+     *
+     * This is only possible if async transfers are enabled,
+     * there actually are any transfer commands, and if the
+     * command list does not use any other synchronization.
+     * \returns \c true if \ref submitAsyncTransfer can be used
+     */
+    bool isAsyncTransfer() const;
+
+    /**
+     * \brief Queries async transfer ID
+     *
+     * Resources used by this command list are
+     * marked with this ID. Will be 0 if async
+     * transfers are not enabled.
+     * \returns Async transfer ID
+     */
+    uint64_t getAsyncTransferId() const {
+      return m_asyncTransferId;
+    }
+
+    /**
+     * \brief Queries async transfer dependency
+     *
+     * Any command list that performs async transfers
+     * with an ID less than or equal to this one must
+     * be submitted before this command list.
+     * \returns Most recent async transfer ID used
+     */
+    uint64_t getAsyncTransferDependency() const {
+      return m_asyncTransferDeps;
+    }
+
+    /**
+     * \brief Queries timeline value of async transfers
+     *
+     * Only valid after \ref submitAsyncTransfer.
+     * \returns Semaphore value signaled by transfers
+     */
+    uint64_t getAsyncTransferValue() const {
+      return m_asyncTransferValue;
+    }
     
     /**
      * \brief Tracks a GPU event
@@ -297,6 +394,17 @@ namespace dxvk {
     void trackGpuQuery(DxvkGpuQueryHandle handle) {
       m_gpuQueryTracker.trackQuery(handle);
     }
+
+    /**
+     * \brief Tracks a query that gets resolved
+     *
+     * Marks the query result as available once
+     * the command list has finished executing.
+     * \param [in] handle Query handle
+     */
+    void trackGpuQueryResolve(DxvkGpuQueryHandle handle) {
+      m_gpuQueryTracker.trackResolve(handle);
+    }
     
     /**
      * \brief Tracks a graphics pipeline
@@ -323,6 +431,7 @@ namespace dxvk {
      * \brief Notifies resources and signals
      */
     void notifyObjects() {
+      m_gpuQueryTracker.notify();
       m_resources.notify();
       m_signalTracker.notify();
     }
@@ -391,6 +500,15 @@ namespace dxvk {
     }
 
 
+    void getDescriptor(
+      const VkDescriptorGetInfoEXT*       descriptorInfo,
+            size_t                        dataSize,
+            void*                         data) {
+      m_vkd->vkGetDescriptorEXT(m_vkd->device(),
+        descriptorInfo, dataSize, data);
+    }
+
+
     void cmdBeginQuery(
             VkQueryPool             queryPool,
             uint32_t                query,
@@ -458,6 +576,49 @@ namespace dxvk {
     }
 
 
+    void cmdBindDescriptorBuffers(
+            uint32_t                  bufferCount,
+      const VkDescriptorBufferBindingInfoEXT* bindingInfos) {
+      m_vkd->vkCmdBindDescriptorBuffersEXT(m_cmd.execBuffer,
+        bufferCount, bindingInfos);
+    }
+
+
+    void cmdSetDescriptorBufferOffsets(
+            VkPipelineBindPoint       pipeline,
+            VkPipelineLayout          pipelineLayout,
+            uint32_t                  firstSet,
+            uint32_t                  setCount,
+      const VkDeviceSize*             offsets) {
+      // All sets are sourced from the same descriptor buffer
+      static const std::array<uint32_t, DxvkDescriptorSets::SetCount> bufferIndices = { };
+
+      m_vkd->vkCmdSetDescriptorBufferOffsetsEXT(m_cmd.execBuffer,
+        pipeline, pipelineLayout, firstSet, setCount,
+        bufferIndices.data(), offsets);
+    }
+
+
+    void cmdPushDescriptorSet(
+            VkPipelineBindPoint       pipeline,
+            VkPipelineLayout          pipelineLayout,
+            uint32_t                  descriptorWriteCount,
+      const VkWriteDescriptorSet*     descriptorWrites) {
+      m_vkd->vkCmdPushDescriptorSetKHR(m_cmd.execBuffer,
+        pipeline, pipelineLayout, 0,
+        descriptorWriteCount, descriptorWrites);
+    }
+
+
+    void cmdPushDescriptorSetWithTemplate(
+            VkDescriptorUpdateTemplate descriptorTemplate,
+            VkPipelineLayout          pipelineLayout,
+      const void*                     data) {
+      m_vkd->vkCmdPushDescriptorSetWithTemplateKHR(m_cmd.execBuffer,
+        descriptorTemplate, pipelineLayout, 0, data);
+    }
+
+
     void cmdBindIndexBuffer(
             VkBuffer                buffer,
             VkDeviceSize            offset,
@@ -779,6 +940,16 @@ namespace dxvk {
     }
 
 
+    void cmdResetEvent(
+            DxvkCmdBuffer           cmdBuffer,
+            VkEvent                 event,
+            VkPipelineStageFlags2   stageMask) {
+      m_cmd.usedFlags.set(cmdBuffer);
+
+      m_vkd->vkCmdResetEvent2(getCmdBuffer(cmdBuffer), event, stageMask);
+    }
+
+
     void cmdResolveImage(
       const VkResolveImageInfo2*    resolveInfo) {
       m_cmd.usedFlags.set(DxvkCmdBuffer::ExecBuffer);
@@ -872,11 +1043,12 @@ namespace dxvk {
 
 
     void cmdSetEvent(
+            DxvkCmdBuffer           cmdBuffer,
             VkEvent                 event,
       const VkDependencyInfo*       dependencyInfo) {
-      m_cmd.usedFlags.set(DxvkCmdBuffer::ExecBuffer);
+      m_cmd.usedFlags.set(cmdBuffer);
 
-      m_vkd->vkCmdSetEvent2(m_cmd.execBuffer, event, dependencyInfo);
+      m_vkd->vkCmdSetEvent2(getCmdBuffer(cmdBuffer), event, dependencyInfo);
     }
 
 
@@ -956,6 +1128,16 @@ namespace dxvk {
     }
 
 
+    void cmdWaitEvent(
+            DxvkCmdBuffer           cmdBuffer,
+            VkEvent                 event,
+      const VkDependencyInfo*       dependencyInfo) {
+      m_cmd.usedFlags.set(cmdBuffer);
+
+      m_vkd->vkCmdWaitEvents2(getCmdBuffer(cmdBuffer), 1, &event, dependencyInfo);
+    }
+
+
     void cmdWriteTimestamp(
             VkPipelineStageFlagBits2 pipelineStage,
             VkQueryPool             queryPool,
@@ -1026,6 +1208,13 @@ namespace dxvk {
       m_descriptorPools.push_back({ pool, manager });
     }
 
+
+    void trackDescriptorBuffer(
+      const Rc<DxvkDescriptorBuffer>&     buffer,
+      const Rc<DxvkDescriptorManager>&    manager) {
+      m_descriptorBuffers.push_back({ buffer, manager });
+    }
+
   private:
     
     DxvkDevice*               m_device;
@@ -1041,6 +1230,12 @@ namespace dxvk {
     VkFence                   m_fence         = VK_NULL_HANDLE;
 
     DxvkCommandSubmissionInfo m_cmd;
+    uint64_t                  m_submissionId = 0;
+
+    uint64_t                  m_asyncTransferId     = 0;
+    uint64_t                  m_asyncTransferDeps   = 0;
+    uint64_t                  m_asyncTransferValue  = 0;
+    VkSemaphore               m_asyncTransferSemaphore = VK_NULL_HANDLE;
 
     PresenterSync             m_wsiSemaphores = { };
 
@@ -1063,6 +1258,10 @@ namespace dxvk {
       Rc<DxvkDescriptorPool>,
       Rc<DxvkDescriptorManager>>> m_descriptorPools;
 
+    std::vector<std::pair<
+      Rc<DxvkDescriptorBuffer>,
+      Rc<DxvkDescriptorManager>>> m_descriptorBuffers;
+
     std::vector<DxvkGraphicsPipeline*> m_pipelines;
 
     VkCommandBuffer getCmdBuffer(DxvkCmdBuffer cmdBuffer) const {
@@ -1084,6 +1283,8 @@ namespace dxvk {
 
     void endCommandBuffer(VkCommandBuffer cmdBuffer);
 
+    static uint64_t allocSubmissionId();
+
   };
   
 }
@@ -110,6 +110,7 @@ namespace dxvk {
       &scState.scInfo);
 
     VkComputePipelineCreateInfo info = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+    info.flags                = m_device->getShaderPipelineCreateFlags();
     info.stage                = *stageInfo.getStageInfos();
     info.layout               = m_bindings->getPipelineLayout(false);
     info.basePipelineIndex    = -1;
@@ -65,6 +65,32 @@ namespace dxvk {
     // Maintenance5 introduced a bounded BindIndexBuffer function
     if (m_device->features().khrMaintenance5.maintenance5)
       m_features.set(DxvkContextFeature::IndexBufferRobustness);
+
+    // Split barriers between uploads and prior rendering work
+    if (m_device->config().enableSplitBarriers)
+      m_features.set(DxvkContextFeature::SplitBarriers);
+
+    // Write descriptors directly into descriptor buffer memory
+    // rather than allocating and updating descriptor sets
+    if (m_device->canUseDescriptorBuffer())
+      m_features.set(DxvkContextFeature::DescriptorBuffer);
+
+    // Meta operations only use a handful of descriptors,
+    // so they can push them instead of allocating sets
+    if (m_device->canUseMetaPushDescriptors())
+      m_features.set(DxvkContextFeature::PushDescriptors);
+
+    // Resource initialization does not need to stall rendering
+    // until the initialized resources are actually being used
+    if (type == DxvkContextType::Supplementary && m_device->canUseAsyncTransfer())
+      m_features.set(DxvkContextFeature::AsyncTransfer);
+
+    // Uploads into the init command buffer only consist of transfer
+    // writes, so a single global dependency can cover all of them
+    m_initEventBarrier.srcStageMask  = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    m_initEventBarrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    m_initEventBarrier.dstStageMask  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    m_initEventBarrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
   }
   
   
@@ -77,9 +103,17 @@ namespace dxvk {
     m_cmd = cmdList;
     m_cmd->init();
 
+    if (m_features.test(DxvkContextFeature::AsyncTransfer))
+      m_cmd->enableAsyncTransfer();
+
     if (m_descriptorPool == nullptr)
       m_descriptorPool = m_descriptorManager->getDescriptorPool();
 
+    m_descriptorPool->clearSetCache();
+
+    if (m_descriptorBuffer == nullptr && m_features.test(DxvkContextFeature::DescriptorBuffer))
+      m_descriptorBuffer = m_descriptorManager->getDescriptorBuffer();
+
     this->beginCurrentCommands();
   }
   
@@ -92,6 +126,11 @@ namespace dxvk {
       m_descriptorPool = m_descriptorManager->getDescriptorPool();
     }
 
+    if (m_descriptorBuffer != nullptr && m_descriptorBuffer->shouldSubmit(false)) {
+      m_cmd->trackDescriptorBuffer(m_descriptorBuffer, m_descriptorManager);
+      m_descriptorBuffer = m_descriptorManager->getDescriptorBuffer();
+    }
+
     m_cmd->finalize();
     return std::exchange(m_cmd, nullptr);
   }
@@ -102,6 +141,15 @@ namespace dxvk {
       m_cmd->trackDescriptorPool(m_descriptorPool, m_descriptorManager);
       m_descriptorPool = m_descriptorManager->getDescriptorPool();
     }
+
+    // Replacing the descriptor buffer invalidates all bound sets
+    if (m_descriptorBuffer != nullptr && m_descriptorBuffer->shouldSubmit(true)) {
+      m_cmd->trackDescriptorBuffer(m_descriptorBuffer, m_descriptorManager);
+      m_descriptorBuffer = m_descriptorManager->getDescriptorBuffer();
+
+      m_flags.set(DxvkContextFlag::DirtyDescriptorBuffer);
+      m_descriptorState.dirtyStages(VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT);
+    }
   }
 
 
@@ -211,6 +259,8 @@ namespace dxvk {
     
       if (m_execBarriers.isBufferDirty(bufferSlice, DxvkAccess::Write))
         m_execBarriers.recordCommands(m_cmd);
+    } else {
+      this->prepareInitCommands();
     }
 
     DxvkCmdBuffer cmdBuffer = replaceBuffer
@@ -266,19 +316,15 @@ namespace dxvk {
     DxvkMetaClearPipeline pipeInfo = m_common->metaClear().getClearBufferPipeline(
       lookupFormatInfo(bufferView->info().format)->flags);
     
-    // Create a descriptor set pointing to the view
+    // Create a descriptor pointing to the view
     VkBufferView viewObject = bufferView->handle();
     
-    VkDescriptorSet descriptorSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-    
     VkWriteDescriptorSet descriptorWrite = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-    descriptorWrite.dstSet           = descriptorSet;
     descriptorWrite.dstBinding       = 0;
     descriptorWrite.dstArrayElement  = 0;
     descriptorWrite.descriptorCount  = 1;
     descriptorWrite.descriptorType   = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
     descriptorWrite.pTexelBufferView = &viewObject;
-    m_cmd->updateDescriptorSets(1, &descriptorWrite);
     
     // Prepare shader arguments
     DxvkMetaClearArgs pushArgs = { };
@@ -292,10 +338,10 @@ namespace dxvk {
     m_cmd->cmdBindPipeline(
       VK_PIPELINE_BIND_POINT_COMPUTE,
       pipeInfo.pipeline);
-    m_cmd->cmdBindDescriptorSet(
+    this->bindMetaDescriptors(
       VK_PIPELINE_BIND_POINT_COMPUTE,
-      pipeInfo.pipeLayout, descriptorSet,
-      0, nullptr);
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      1, &descriptorWrite);
     m_cmd->cmdPushConstants(
       pipeInfo.pipeLayout,
       VK_SHADER_STAGE_COMPUTE_BIT,
@@ -402,18 +448,23 @@ namespace dxvk {
     bool srcIsReadOnly = DxvkBarrierSet::getAccessTypes(srcBuffer->info().access) == DxvkAccess::Read;
     bool replaceBuffer = srcIsReadOnly && this->tryInvalidateDeviceLocalBuffer(dstBuffer, numBytes);
 
+    // Otherwise, try to move the copy out of the current render pass
+    bool useInitBuffer = replaceBuffer || this->tryHoistBufferTransfer(dstBuffer, srcBuffer.ptr());
+
     auto srcSlice = srcBuffer->getSliceHandle(srcOffset, numBytes);
     auto dstSlice = dstBuffer->getSliceHandle(dstOffset, numBytes);
 
-    if (!replaceBuffer) {
+    if (!useInitBuffer) {
       this->spillRenderPass(true);
 
       if (m_execBarriers.isBufferDirty(srcSlice, DxvkAccess::Read)
        || m_execBarriers.isBufferDirty(dstSlice, DxvkAccess::Write))
         m_execBarriers.recordCommands(m_cmd);
+    } else {
+      this->prepareInitCommands();
     }
 
-    DxvkCmdBuffer cmdBuffer = replaceBuffer
+    DxvkCmdBuffer cmdBuffer = useInitBuffer
       ? DxvkCmdBuffer::InitBuffer
       : DxvkCmdBuffer::ExecBuffer;
 
@@ -430,7 +481,7 @@ namespace dxvk {
 
     m_cmd->cmdCopyBuffer(cmdBuffer, &copyInfo);
 
-    auto& barriers = replaceBuffer
+    auto& barriers = useInitBuffer
       ? m_initBarriers
       : m_execBarriers;
 
@@ -490,8 +541,24 @@ namespace dxvk {
           VkDeviceSize          srcOffset,
           VkDeviceSize          rowAlignment,
           VkDeviceSize          sliceAlignment) {
-    this->spillRenderPass(true);
-    this->prepareImage(dstImage, vk::makeSubresourceRange(dstSubresource));
+    bool useInitBuffer = this->tryHoistImageTransfer(dstImage, srcBuffer.ptr());
+
+    if (!useInitBuffer) {
+      this->spillRenderPass(true);
+      this->prepareImage(dstImage, vk::makeSubresourceRange(dstSubresource));
+    } else {
+      this->prepareInitCommands();
+    }
+
+    DxvkCmdBuffer cmdBuffer = useInitBuffer
+      ? DxvkCmdBuffer::InitBuffer
+      : DxvkCmdBuffer::ExecBuffer;
+
+    // Hoisted copies need the layout transition to happen
+    // in the init command buffer as well, so there is no
+    // separate set of acquire barriers in that case.
+    auto& acquires = useInitBuffer ? m_initBarriers : m_execAcquires;
+    auto& barriers = useInitBuffer ? m_initBarriers : m_execBarriers;
 
     auto srcSlice = srcBuffer->getSliceHandle(srcOffset, 0);
 
@@ -502,9 +569,9 @@ namespace dxvk {
     auto dstSubresourceRange = vk::makeSubresourceRange(dstSubresource);
     dstSubresourceRange.aspectMask = dstFormatInfo->aspectMask;
     
-    if (m_execBarriers.isImageDirty(dstImage, dstSubresourceRange, DxvkAccess::Write)
-     || m_execBarriers.isBufferDirty(srcSlice, DxvkAccess::Read))
-      m_execBarriers.recordCommands(m_cmd);
+    if (barriers.isImageDirty(dstImage, dstSubresourceRange, DxvkAccess::Write)
+     || barriers.isBufferDirty(srcSlice, DxvkAccess::Read))
+      barriers.recordCommands(m_cmd);
 
     // Initialize the image if the entire subresource is covered
     VkImageLayout dstImageLayoutInitial  = dstImage->info().layout;
@@ -514,7 +581,7 @@ namespace dxvk {
       dstImageLayoutInitial = VK_IMAGE_LAYOUT_UNDEFINED;
 
     if (dstImageLayoutTransfer != dstImageLayoutInitial) {
-      m_execAcquires.accessImage(
+      acquires.accessImage(
         dstImage, dstSubresourceRange,
         dstImageLayoutInitial,
         VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
@@ -523,12 +590,12 @@ namespace dxvk {
         VK_ACCESS_TRANSFER_WRITE_BIT);
     }
       
-    m_execAcquires.recordCommands(m_cmd);
+    acquires.recordCommands(m_cmd);
 
-    this->copyImageBufferData<true>(DxvkCmdBuffer::ExecBuffer, dstImage, dstSubresource,
+    this->copyImageBufferData<true>(cmdBuffer, dstImage, dstSubresource,
       dstOffset, dstExtent, dstImageLayoutTransfer, srcSlice, rowAlignment, sliceAlignment);
 
-    m_execBarriers.accessImage(
+    barriers.accessImage(
       dstImage, dstSubresourceRange,
       dstImageLayoutTransfer,
       VK_PIPELINE_STAGE_TRANSFER_BIT,
@@ -537,7 +604,7 @@ namespace dxvk {
       dstImage->info().stages,
       dstImage->info().access);
 
-    m_execBarriers.accessBuffer(srcSlice,
+    barriers.accessBuffer(srcSlice,
       VK_PIPELINE_STAGE_TRANSFER_BIT,
       VK_ACCESS_TRANSFER_READ_BIT,
       srcBuffer->info().stages,
@@ -546,6 +613,142 @@ namespace dxvk {
     m_cmd->trackResource<DxvkAccess::Write>(dstImage);
     m_cmd->trackResource<DxvkAccess::Read>(srcBuffer);
   }
+
+
+  void DxvkContext::copyBufferToImageRegions(
+    const Rc<DxvkImage>&        dstImage,
+    const Rc<DxvkBuffer>&       srcBuffer,
+          uint32_t              regionCount,
+    const VkBufferImageCopy*    pRegions) {
+    if (regionCount == 1) {
+      const auto& region = pRegions[0];
+
+      this->copyBufferToImage(dstImage, region.imageSubresource,
+        region.imageOffset, region.imageExtent,
+        srcBuffer, region.bufferOffset, 0, 0);
+      return;
+    }
+
+    bool useInitBuffer = this->tryHoistImageTransfer(dstImage, srcBuffer.ptr());
+
+    if (!useInitBuffer)
+      this->spillRenderPass(true);
+    else
+      this->prepareInitCommands();
+
+    DxvkCmdBuffer cmdBuffer = useInitBuffer
+      ? DxvkCmdBuffer::InitBuffer
+      : DxvkCmdBuffer::ExecBuffer;
+
+    auto& acquires = useInitBuffer ? m_initBarriers : m_execAcquires;
+    auto& barriers = useInitBuffer ? m_initBarriers : m_execBarriers;
+
+    auto srcSlice = srcBuffer->getSliceHandle();
+    auto dstFormatInfo = dstImage->formatInfo();
+
+    // Several regions may write to the same subresource, in which
+    // case we must only emit one set of barriers for that subresource
+    small_vector<VkImageSubresourceRange, 16> dstRanges;
+
+    for (uint32_t i = 0; i < regionCount; i++) {
+      auto range = vk::makeSubresourceRange(pRegions[i].imageSubresource);
+      range.aspectMask = dstFormatInfo->aspectMask;
+
+      bool found = false;
+
+      for (size_t j = 0; j < dstRanges.size() && !found; j++) {
+        found = dstRanges[j].baseMipLevel == range.baseMipLevel
+             && dstRanges[j].baseArrayLayer == range.baseArrayLayer;
+      }
+
+      if (!found)
+        dstRanges.push_back(range);
+    }
+
+    bool dirty = barriers.isBufferDirty(srcSlice, DxvkAccess::Read);
+
+    for (size_t i = 0; i < dstRanges.size(); i++) {
+      if (!useInitBuffer)
+        this->prepareImage(dstImage, dstRanges[i]);
+
+      dirty |= barriers.isImageDirty(dstImage, dstRanges[i], DxvkAccess::Write);
+    }
+
+    if (dirty)
+      barriers.recordCommands(m_cmd);
+
+    VkImageLayout dstImageLayoutTransfer = dstImage->pickLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    for (size_t i = 0; i < dstRanges.size(); i++) {
+      VkImageLayout dstImageLayoutInitial = dstImage->info().layout;
+
+      // Regions can't overlap, so a region that covers the full
+      // subresource is the only one writing to that subresource
+      for (uint32_t j = 0; j < regionCount; j++) {
+        const auto& region = pRegions[j];
+
+        if (region.imageSubresource.mipLevel == dstRanges[i].baseMipLevel
+         && region.imageSubresource.baseArrayLayer == dstRanges[i].baseArrayLayer
+         && dstImage->isFullSubresource(region.imageSubresource, region.imageExtent))
+          dstImageLayoutInitial = VK_IMAGE_LAYOUT_UNDEFINED;
+      }
+
+      if (dstImageLayoutTransfer != dstImageLayoutInitial) {
+        acquires.accessImage(
+          dstImage, dstRanges[i],
+          dstImageLayoutInitial,
+          VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+          dstImageLayoutTransfer,
+          VK_PIPELINE_STAGE_TRANSFER_BIT,
+          VK_ACCESS_TRANSFER_WRITE_BIT);
+      }
+    }
+
+    acquires.recordCommands(m_cmd);
+
+    small_vector<VkBufferImageCopy2, 16> copyRegions;
+
+    for (uint32_t i = 0; i < regionCount; i++) {
+      VkBufferImageCopy2 copyRegion = { VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2 };
+      copyRegion.bufferOffset      = srcSlice.offset + pRegions[i].bufferOffset;
+      copyRegion.bufferRowLength   = pRegions[i].bufferRowLength;
+      copyRegion.bufferImageHeight = pRegions[i].bufferImageHeight;
+      copyRegion.imageSubresource  = pRegions[i].imageSubresource;
+      copyRegion.imageOffset       = pRegions[i].imageOffset;
+      copyRegion.imageExtent       = pRegions[i].imageExtent;
+
+      copyRegions.push_back(copyRegion);
+    }
+
+    VkCopyBufferToImageInfo2 copyInfo = { VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2 };
+    copyInfo.srcBuffer = srcSlice.handle;
+    copyInfo.dstImage = dstImage->handle();
+    copyInfo.dstImageLayout = dstImageLayoutTransfer;
+    copyInfo.regionCount = copyRegions.size();
+    copyInfo.pRegions = copyRegions.data();
+
+    m_cmd->cmdCopyBufferToImage(cmdBuffer, &copyInfo);
+
+    for (size_t i = 0; i < dstRanges.size(); i++) {
+      barriers.accessImage(
+        dstImage, dstRanges[i],
+        dstImageLayoutTransfer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT,
+        dstImage->info().layout,
+        dstImage->info().stages,
+        dstImage->info().access);
+    }
+
+    barriers.accessBuffer(srcSlice,
+      VK_PIPELINE_STAGE_TRANSFER_BIT,
+      VK_ACCESS_TRANSFER_READ_BIT,
+      srcBuffer->info().stages,
+      srcBuffer->info().access);
+
+    m_cmd->trackResource<DxvkAccess::Write>(dstImage);
+    m_cmd->trackResource<DxvkAccess::Read>(srcBuffer);
+  }
   
   
   void DxvkContext::copyImage(
@@ -759,9 +962,6 @@ namespace dxvk {
     descriptors.srcDepth   = dView->getDescriptor(VK_IMAGE_VIEW_TYPE_2D_ARRAY, layout).image;
     descriptors.srcStencil = sView->getDescriptor(VK_IMAGE_VIEW_TYPE_2D_ARRAY, layout).image;
 
-    VkDescriptorSet dset = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-    m_cmd->updateDescriptorSetWithTemplate(dset, pipeInfo.dsetTemplate, &descriptors);
-
     // Since this is a meta operation, the image may be
     // in a different layout and we have to transition it
     auto subresourceRange = vk::makeSubresourceRange(srcSubresource);
@@ -792,10 +992,10 @@ namespace dxvk {
       VK_PIPELINE_BIND_POINT_COMPUTE,
       pipeInfo.pipeHandle);
     
-    m_cmd->cmdBindDescriptorSet(
+    this->bindMetaDescriptorsWithTemplate(
       VK_PIPELINE_BIND_POINT_COMPUTE,
-      pipeInfo.pipeLayout, dset,
-      0, nullptr);
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      pipeInfo.dsetTemplate, &descriptors);
     
     m_cmd->cmdPushConstants(
       pipeInfo.pipeLayout,
@@ -923,7 +1123,6 @@ namespace dxvk {
     }
 
     auto pipeInfo = m_common->metaCopy().getCopyBufferImagePipeline();
-    VkDescriptorSet descriptorSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
 
     std::array<VkWriteDescriptorSet, 2> descriptorWrites;
 
@@ -938,7 +1137,7 @@ namespace dxvk {
 
       write->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
       write->pNext = nullptr;
-      write->dstSet = descriptorSet;
+      write->dstSet = VK_NULL_HANDLE;
       write->dstBinding = i;
       write->dstArrayElement = 0;
       write->descriptorCount = 1;
@@ -948,8 +1147,6 @@ namespace dxvk {
       write->pTexelBufferView = &info->second;
     }
 
-    m_cmd->updateDescriptorSets(descriptorWrites.size(), descriptorWrites.data());
-
     DxvkCopyBufferImageArgs args = { };
     args.dstOffset = dstOffset;
     args.srcOffset = srcOffset;
@@ -961,10 +1158,10 @@ namespace dxvk {
       VK_PIPELINE_BIND_POINT_COMPUTE,
       pipeInfo.pipeHandle);
     
-    m_cmd->cmdBindDescriptorSet(
+    this->bindMetaDescriptors(
       VK_PIPELINE_BIND_POINT_COMPUTE,
-      pipeInfo.pipeLayout, descriptorSet,
-      0, nullptr);
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      descriptorWrites.size(), descriptorWrites.data());
     
     m_cmd->cmdPushConstants(
       pipeInfo.pipeLayout,
@@ -1081,9 +1278,6 @@ namespace dxvk {
     descriptors.dstStencil = tmpBufferViewS->handle();
     descriptors.srcBuffer  = srcBuffer->getDescriptor(srcBufferOffset, VK_WHOLE_SIZE).buffer;
 
-    VkDescriptorSet dset = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-    m_cmd->updateDescriptorSetWithTemplate(dset, pipeInfo.dsetTemplate, &descriptors);
-
     // Unpack the source buffer to temporary buffers
     DxvkMetaPackArgs args;
     args.srcOffset = srcOffset;
@@ -1095,10 +1289,10 @@ namespace dxvk {
       VK_PIPELINE_BIND_POINT_COMPUTE,
       pipeInfo.pipeHandle);
     
-    m_cmd->cmdBindDescriptorSet(
+    this->bindMetaDescriptorsWithTemplate(
       VK_PIPELINE_BIND_POINT_COMPUTE,
-      pipeInfo.pipeLayout, dset,
-      0, nullptr);
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      pipeInfo.dsetTemplate, &descriptors);
     
     m_cmd->cmdPushConstants(
       pipeInfo.pipeLayout,
@@ -1427,6 +1621,8 @@ namespace dxvk {
     const Rc<DxvkBuffer>&           buffer) {
     auto slice = buffer->getSliceHandle();
 
+    this->prepareInitCommands();
+
     m_cmd->cmdFillBuffer(DxvkCmdBuffer::InitBuffer,
       slice.handle, slice.offset,
       dxvk::align(slice.length, 4), 0);
@@ -1734,10 +1930,8 @@ namespace dxvk {
       // Width, height and layer count for the current pass
       VkExtent3D passExtent = mipGenerator->computePassExtent(i);
       
-      // Create descriptor set with the current source view
+      // Create descriptor with the current source view
       descriptorImage.imageView = mipGenerator->getSrcView(i);
-      descriptorWrite.dstSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-      m_cmd->updateDescriptorSets(1, &descriptorWrite);
       
       // Set up viewport and scissor rect
       VkViewport viewport;
@@ -1777,8 +1971,9 @@ namespace dxvk {
 
       m_cmd->cmdBeginRendering(&renderingInfo);
       m_cmd->cmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeInfo.pipeHandle);
-      m_cmd->cmdBindDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS,
-        pipeInfo.pipeLayout, descriptorWrite.dstSet, 0, nullptr);
+
+      this->bindMetaDescriptors(VK_PIPELINE_BIND_POINT_GRAPHICS,
+        pipeInfo.pipeLayout, pipeInfo.dsetLayout, 1, &descriptorWrite);
       
       m_cmd->cmdSetViewport(1, &viewport);
       m_cmd->cmdSetScissor(1, &scissor);
@@ -2256,17 +2451,21 @@ namespace dxvk {
           VkDeviceSize              offset,
           VkDeviceSize              size,
     const void*                     data) {
-    bool replaceBuffer = this->tryInvalidateDeviceLocalBuffer(buffer, size);
+    bool useInitBuffer = this->tryInvalidateDeviceLocalBuffer(buffer, size)
+                      || this->tryHoistBufferTransfer(buffer, nullptr);
+
     auto bufferSlice = buffer->getSliceHandle(offset, size);
 
-    if (!replaceBuffer) {
+    if (!useInitBuffer) {
       this->spillRenderPass(true);
     
       if (m_execBarriers.isBufferDirty(bufferSlice, DxvkAccess::Write))
         m_execBarriers.recordCommands(m_cmd);
+    } else {
+      this->prepareInitCommands();
     }
 
-    DxvkCmdBuffer cmdBuffer = replaceBuffer
+    DxvkCmdBuffer cmdBuffer = useInitBuffer
       ? DxvkCmdBuffer::InitBuffer
       : DxvkCmdBuffer::ExecBuffer;
 
@@ -2276,7 +2475,7 @@ namespace dxvk {
       bufferSlice.length,
       data);
 
-    auto& barriers = replaceBuffer
+    auto& barriers = useInitBuffer
       ? m_initBarriers
       : m_execBarriers;
 
@@ -2320,7 +2519,7 @@ namespace dxvk {
 
     util::packImageData(tmpBuffer->mapPtr(0), data,
       extent3D, formatInfo->elementSize,
-      pitchPerRow, pitchPerLayer);
+      pitchPerRow, pitchPerLayer, true);
     
     copyPackedBufferToDepthStencilImage(
       image, subresources, imageOffset, imageExtent,
@@ -2748,7 +2947,7 @@ namespace dxvk {
     depInfo.memoryBarrierCount = 1;
     depInfo.pMemoryBarriers = &barrier;
 
-    m_cmd->cmdSetEvent(handle.event, &depInfo);
+    m_cmd->cmdSetEvent(DxvkCmdBuffer::ExecBuffer, handle.event, &depInfo);
 
     m_cmd->trackGpuEvent(event->reset(handle));
     m_cmd->trackResource<DxvkAccess::None>(event);
@@ -2987,16 +3186,14 @@ namespace dxvk {
     descriptorImage.imageLayout = srcLayout;
     
     VkWriteDescriptorSet descriptorWrite = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-    descriptorWrite.dstSet           = m_descriptorPool->alloc(pipeInfo.dsetLayout);
     descriptorWrite.dstBinding       = 0;
     descriptorWrite.dstArrayElement  = 0;
     descriptorWrite.descriptorCount  = 1;
     descriptorWrite.descriptorType   = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     descriptorWrite.pImageInfo       = &descriptorImage;
 
-    m_cmd->updateDescriptorSets(1, &descriptorWrite);
-    m_cmd->cmdBindDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS,
-      pipeInfo.pipeLayout, descriptorWrite.dstSet, 0, nullptr);
+    this->bindMetaDescriptors(VK_PIPELINE_BIND_POINT_GRAPHICS,
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout, 1, &descriptorWrite);
 
     // Compute shader parameters for the operation
     VkExtent3D srcExtent = srcImage->mipLevelExtent(region.srcSubresource.mipLevel);
@@ -3256,7 +3453,7 @@ namespace dxvk {
         auto stagingHandle = stagingSlice.getSliceHandle();
 
         util::packImageData(stagingHandle.mapPtr, layerData,
-          blockCount, elementSize, rowPitch, slicePitch);
+          blockCount, elementSize, rowPitch, slicePitch, true);
 
         auto subresource = imageSubresource;
         subresource.aspectMask = aspect;
@@ -3411,22 +3608,18 @@ namespace dxvk {
     DxvkMetaClearPipeline pipeInfo = m_common->metaClear().getClearImagePipeline(
       imageView->type(), lookupFormatInfo(imageView->info().format)->flags);
     
-    // Create a descriptor set pointing to the view
-    VkDescriptorSet descriptorSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-    
+    // Create a descriptor pointing to the view
     VkDescriptorImageInfo viewInfo;
     viewInfo.sampler      = VK_NULL_HANDLE;
     viewInfo.imageView    = imageView->handle();
     viewInfo.imageLayout  = imageView->imageInfo().layout;
     
     VkWriteDescriptorSet descriptorWrite = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-    descriptorWrite.dstSet           = descriptorSet;
     descriptorWrite.dstBinding       = 0;
     descriptorWrite.dstArrayElement  = 0;
     descriptorWrite.descriptorCount  = 1;
     descriptorWrite.descriptorType   = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
     descriptorWrite.pImageInfo       = &viewInfo;
-    m_cmd->updateDescriptorSets(1, &descriptorWrite);
     
     // Prepare shader arguments
     DxvkMetaClearArgs pushArgs = { };
@@ -3445,10 +3638,10 @@ namespace dxvk {
     m_cmd->cmdBindPipeline(
       VK_PIPELINE_BIND_POINT_COMPUTE,
       pipeInfo.pipeline);
-    m_cmd->cmdBindDescriptorSet(
+    this->bindMetaDescriptors(
       VK_PIPELINE_BIND_POINT_COMPUTE,
-      pipeInfo.pipeLayout, descriptorSet,
-      0, nullptr);
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      1, &descriptorWrite);
     m_cmd->cmdPushConstants(
       pipeInfo.pipeLayout,
       VK_SHADER_STAGE_COMPUTE_BIT,
@@ -3752,9 +3945,7 @@ namespace dxvk {
     DxvkMetaCopyPipeline pipeInfo = m_common->metaCopy().getPipeline(
       views->getSrcViewType(), dstFormat, dstImage->info().sampleCount);
 
-    // Create and initialize descriptor set    
-    VkDescriptorSet descriptorSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-
+    // Set up descriptors
     std::array<VkDescriptorImageInfo, 2> descriptorImages = {{
       { VK_NULL_HANDLE, views->getSrcView(),        srcLayout },
       { VK_NULL_HANDLE, views->getSrcStencilView(), srcLayout },
@@ -3764,17 +3955,12 @@ namespace dxvk {
 
     for (uint32_t i = 0; i < descriptorWrites.size(); i++) {
       descriptorWrites[i] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-      descriptorWrites[i].dstSet = descriptorSet;
       descriptorWrites[i].dstBinding = i;
       descriptorWrites[i].descriptorCount = 1;
       descriptorWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
       descriptorWrites[i].pImageInfo = &descriptorImages[i];
     }
 
-    m_cmd->updateDescriptorSets(
-      descriptorWrites.size(),
-      descriptorWrites.data());
-
     // Set up render state    
     VkViewport viewport;
     viewport.x = float(dstOffset.x);
@@ -3819,8 +4005,9 @@ namespace dxvk {
     // Perform the actual copy operation
     m_cmd->cmdBeginRendering(&renderingInfo);
     m_cmd->cmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeInfo.pipeHandle);
-    m_cmd->cmdBindDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS,
-      pipeInfo.pipeLayout, descriptorSet, 0, nullptr);
+    this->bindMetaDescriptors(VK_PIPELINE_BIND_POINT_GRAPHICS,
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      descriptorWrites.size(), descriptorWrites.data());
 
     m_cmd->cmdSetViewport(1, &viewport);
     m_cmd->cmdSetScissor(1, &scissor);
@@ -4378,9 +4565,7 @@ namespace dxvk {
     DxvkMetaResolvePipeline pipeInfo = m_common->metaResolve().getPipeline(
       dstFormat, srcImage->info().sampleCount, depthMode, stencilMode);
 
-    // Create and initialize descriptor set    
-    VkDescriptorSet descriptorSet = m_descriptorPool->alloc(pipeInfo.dsetLayout);
-
+    // Set up descriptors
     std::array<VkDescriptorImageInfo, 2> descriptorImages = {{
       { VK_NULL_HANDLE, views->getSrcView(),        srcLayout },
       { VK_NULL_HANDLE, views->getSrcStencilView(), srcLayout },
@@ -4390,16 +4575,11 @@ namespace dxvk {
 
     for (uint32_t i = 0; i < descriptorWrites.size(); i++) {
       descriptorWrites[i] = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
-      descriptorWrites[i].dstSet = descriptorSet;
       descriptorWrites[i].dstBinding = i;
       descriptorWrites[i].descriptorCount = 1;
       descriptorWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
       descriptorWrites[i].pImageInfo = &descriptorImages[i];
     }
-    
-    m_cmd->updateDescriptorSets(
-      descriptorWrites.size(),
-      descriptorWrites.data());
 
     // Set up render state    
     VkViewport viewport;
@@ -4447,8 +4627,9 @@ namespace dxvk {
     
     m_cmd->cmdBeginRendering(&renderingInfo);
     m_cmd->cmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeInfo.pipeHandle);
-    m_cmd->cmdBindDescriptorSet(VK_PIPELINE_BIND_POINT_GRAPHICS,
-      pipeInfo.pipeLayout, descriptorSet, 0, nullptr);
+    this->bindMetaDescriptors(VK_PIPELINE_BIND_POINT_GRAPHICS,
+      pipeInfo.pipeLayout, pipeInfo.dsetLayout,
+      descriptorWrites.size(), descriptorWrites.data());
     m_cmd->cmdSetViewport(1, &viewport);
     m_cmd->cmdSetScissor(1, &scissor);
     m_cmd->cmdPushConstants(pipeInfo.pipeLayout,
@@ -5208,9 +5389,48 @@ namespace dxvk {
     this->unbindGraphicsPipeline();
   }
 
+
+  void DxvkContext::bindMetaDescriptors(
+          VkPipelineBindPoint       bindPoint,
+          VkPipelineLayout          pipelineLayout,
+          VkDescriptorSetLayout     setLayout,
+          uint32_t                  descriptorWriteCount,
+          VkWriteDescriptorSet*     descriptorWrites) {
+    if (m_features.test(DxvkContextFeature::PushDescriptors)) {
+      m_cmd->cmdPushDescriptorSet(bindPoint, pipelineLayout,
+        descriptorWriteCount, descriptorWrites);
+    } else {
+      VkDescriptorSet set = m_descriptorPool->alloc(setLayout);
+
+      for (uint32_t i = 0; i < descriptorWriteCount; i++)
+        descriptorWrites[i].dstSet = set;
+
+      m_cmd->updateDescriptorSets(descriptorWriteCount, descriptorWrites);
+      m_cmd->cmdBindDescriptorSet(bindPoint, pipelineLayout, set, 0, nullptr);
+    }
+  }
+
+
+  void DxvkContext::bindMetaDescriptorsWithTemplate(
+          VkPipelineBindPoint       bindPoint,
+          VkPipelineLayout          pipelineLayout,
+          VkDescriptorSetLayout     setLayout,
+          VkDescriptorUpdateTemplate descriptorTemplate,
+    const void*                     data) {
+    if (m_features.test(DxvkContextFeature::PushDescriptors)) {
+      m_cmd->cmdPushDescriptorSetWithTemplate(
+        descriptorTemplate, pipelineLayout, data);
+    } else {
+      VkDescriptorSet set = m_descriptorPool->alloc(setLayout);
+
+      m_cmd->updateDescriptorSetWithTemplate(set, descriptorTemplate, data);
+      m_cmd->cmdBindDescriptorSet(bindPoint, pipelineLayout, set, 0, nullptr);
+    }
+  }
+
   
   template<VkPipelineBindPoint BindPoint>
-  void DxvkContext::updateResourceBindings(const DxvkBindingLayoutObjects* layout) {
+  bool DxvkContext::updateResourceBindings(const DxvkBindingLayoutObjects* layout) {
     const auto& bindings = layout->layout();
 
     // Ensure that the arrays we write descriptor info to are big enough
@@ -5231,21 +5451,60 @@ namespace dxvk {
       : m_descriptorState.getDirtyComputeSets();
     dirtySetMask &= layoutSetMask;
 
-    std::array<VkDescriptorSet, DxvkDescriptorSets::SetCount> sets;
-    m_descriptorPool->alloc(layout, dirtySetMask, sets.data());
+    bool useDescriptorBuffer = m_features.test(DxvkContextFeature::DescriptorBuffer);
+
+    std::array<VkDescriptorSet, DxvkDescriptorSets::SetCount> sets = { };
+    std::array<VkDeviceSize, DxvkDescriptorSets::SetCount> setOffsets = { };
+
+    if (useDescriptorBuffer) {
+      if (unlikely(!m_descriptorBuffer->alloc(layout, dirtySetMask, setOffsets.data()))) {
+        // Binding a new descriptor buffer invalidates all sets that
+        // were previously bound, so we need to write all of them
+        m_cmd->trackDescriptorBuffer(m_descriptorBuffer, m_descriptorManager);
+        m_descriptorBuffer = m_descriptorManager->getDescriptorBuffer();
+
+        m_flags.set(DxvkContextFlag::DirtyDescriptorBuffer);
+        m_descriptorState.dirtyStages(VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT);
+
+        dirtySetMask = layoutSetMask;
+
+        // The layout does not fit into an empty descriptor buffer either,
+        // skip the draw rather than writing past the end of the buffer.
+        if (unlikely(!m_descriptorBuffer->alloc(layout, dirtySetMask, setOffsets.data()))) {
+          Logger::err("DxvkContext: Descriptor buffer too small for pipeline layout, skipping");
+          return false;
+        }
+      }
+
+      if (m_flags.test(DxvkContextFlag::DirtyDescriptorBuffer)) {
+        m_flags.clr(DxvkContextFlag::DirtyDescriptorBuffer);
+
+        VkDescriptorBufferBindingInfoEXT bindingInfo = m_descriptorBuffer->getBindingInfo();
+        m_cmd->cmdBindDescriptorBuffers(1, &bindingInfo);
+      }
+    }
 
     uint32_t descriptorCount = 0;
 
     for (auto setIndex : bit::BitMask(dirtySetMask)) {
       uint32_t bindingCount = bindings.getBindingCount(setIndex);
-      VkDescriptorSet set = sets[setIndex];
+      uint32_t firstDescriptor = descriptorCount;
+
+      const DxvkBindingSetLayout* setLayout = nullptr;
+      char* setData = nullptr;
+
+      if (useDescriptorBuffer) {
+        setLayout = layout->getSetLayoutObjects(setIndex);
+        setData = m_descriptorBuffer->mapPtr(setOffsets[setIndex]);
+      } else {
+        m_descriptorSetKey.reset(layout->getSetLayout(setIndex));
+      }
 
       for (uint32_t j = 0; j < bindingCount; j++) {
         const auto& binding = bindings.getBinding(setIndex, j);
 
-        if (!useDescriptorTemplates) {
+        if (!useDescriptorTemplates && !useDescriptorBuffer) {
           auto& descriptorWrite = m_descriptorWrites[descriptorCount];
-          descriptorWrite.dstSet = set;
           descriptorWrite.dstBinding = j;
           descriptorWrite.descriptorType = binding.descriptorType;
         }
@@ -5394,19 +5653,41 @@ namespace dxvk {
           default:
             break;
         }
+
+        if (useDescriptorBuffer)
+          writeDescriptor(binding, descriptorInfo, setData + setLayout->getDescriptorOffset(j));
+        else
+          m_descriptorSetKey.add(binding.descriptorType, descriptorInfo);
       }
 
-      if (useDescriptorTemplates) {
-        m_cmd->updateDescriptorSetWithTemplate(set,
-          layout->getSetUpdateTemplate(setIndex),
-          &m_descriptors[0]);
+      if (useDescriptorBuffer) {
         descriptorCount = 0;
+      } else {
+        // Reuse a set with identical contents if one was already
+        // written in this command list, and skip the update entirely
+        sets[setIndex] = m_descriptorPool->lookupSet(m_descriptorSetKey);
+
+        if (sets[setIndex]) {
+          descriptorCount = firstDescriptor;
+        } else {
+          sets[setIndex] = m_descriptorPool->allocCached(layout, setIndex, m_descriptorSetKey);
+
+          if (useDescriptorTemplates) {
+            m_cmd->updateDescriptorSetWithTemplate(sets[setIndex],
+              layout->getSetUpdateTemplate(setIndex),
+              &m_descriptors[0]);
+            descriptorCount = 0;
+          } else {
+            for (uint32_t i = firstDescriptor; i < descriptorCount; i++)
+              m_descriptorWrites[i].dstSet = sets[setIndex];
+          }
+        }
       }
 
       // If the next set is not dirty, update and bind all previously
       // updated sets in one go in order to reduce api call overhead.
       if (!(((dirtySetMask >> 1) >> setIndex) & 1u)) {
-        if (!useDescriptorTemplates) {
+        if (!useDescriptorTemplates && !useDescriptorBuffer && descriptorCount) {
           m_cmd->updateDescriptorSets(descriptorCount,
             m_descriptorWrites.data());
           descriptorCount = 0;
@@ -5417,26 +5698,105 @@ namespace dxvk {
         uint32_t firstSet = bit::tzcnt(dirtySetMask);
         dirtySetMask &= (~1u) << setIndex;
 
-        m_cmd->cmdBindDescriptorSets(BindPoint,
-          layout->getPipelineLayout(independentSets),
-          firstSet, setIndex - firstSet + 1, &sets[firstSet],
-          0, nullptr);
+        if (useDescriptorBuffer) {
+          m_cmd->cmdSetDescriptorBufferOffsets(BindPoint,
+            layout->getPipelineLayout(independentSets),
+            firstSet, setIndex - firstSet + 1, &setOffsets[firstSet]);
+        } else {
+          m_cmd->cmdBindDescriptorSets(BindPoint,
+            layout->getPipelineLayout(independentSets),
+            firstSet, setIndex - firstSet + 1, &sets[firstSet],
+            0, nullptr);
+        }
       }
     }
+
+    return true;
+  }
+
+
+  void DxvkContext::writeDescriptor(
+    const DxvkBindingInfo&          binding,
+    const DxvkDescriptorInfo&       descriptorInfo,
+          void*                     dst) {
+    VkDescriptorGetInfoEXT info = { VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT };
+    info.type = binding.descriptorType;
+
+    VkDescriptorAddressInfoEXT addressInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT };
+    bool hasAddress = false;
+
+    switch (binding.descriptorType) {
+      case VK_DESCRIPTOR_TYPE_SAMPLER:
+        info.data.pSampler = &descriptorInfo.image.sampler;
+        break;
+
+      case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        info.data.pCombinedImageSampler = &descriptorInfo.image;
+        break;
+
+      case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        info.data.pSampledImage = &descriptorInfo.image;
+        break;
+
+      case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        info.data.pStorageImage = &descriptorInfo.image;
+        break;
+
+      case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
+        const auto& res = m_rc[binding.resourceBinding];
+
+        if ((hasAddress = res.bufferView != nullptr)) {
+          addressInfo = res.bufferView->getAddressInfo();
+          hasAddress = addressInfo.address != 0;
+        }
+
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER)
+          info.data.pUniformTexelBuffer = hasAddress ? &addressInfo : nullptr;
+        else
+          info.data.pStorageTexelBuffer = hasAddress ? &addressInfo : nullptr;
+      } break;
+
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER: {
+        const auto& res = m_rc[binding.resourceBinding];
+
+        // Buffers without a device address get a null descriptor
+        if ((hasAddress = res.bufferSlice.length() != 0)) {
+          addressInfo = res.bufferSlice.getAddressInfo();
+          hasAddress = addressInfo.address != 0;
+        }
+
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+          info.data.pUniformBuffer = hasAddress ? &addressInfo : nullptr;
+        else
+          info.data.pStorageBuffer = hasAddress ? &addressInfo : nullptr;
+      } break;
+
+      default:
+        return;
+    }
+
+    m_cmd->getDescriptor(&info,
+      m_descriptorManager->getDescriptorSize(binding.descriptorType), dst);
   }
 
 
-  void DxvkContext::updateComputeShaderResources() {
-    this->updateResourceBindings<VK_PIPELINE_BIND_POINT_COMPUTE>(m_state.cp.pipeline->getBindings());
+  bool DxvkContext::updateComputeShaderResources() {
+    if (unlikely(!this->updateResourceBindings<VK_PIPELINE_BIND_POINT_COMPUTE>(m_state.cp.pipeline->getBindings())))
+      return false;
 
     m_descriptorState.clearStages(VK_SHADER_STAGE_COMPUTE_BIT);
+    return true;
   }
   
   
-  void DxvkContext::updateGraphicsShaderResources() {
-    this->updateResourceBindings<VK_PIPELINE_BIND_POINT_GRAPHICS>(m_state.gp.pipeline->getBindings());
+  bool DxvkContext::updateGraphicsShaderResources() {
+    if (unlikely(!this->updateResourceBindings<VK_PIPELINE_BIND_POINT_GRAPHICS>(m_state.gp.pipeline->getBindings())))
+      return false;
 
     m_descriptorState.clearStages(VK_SHADER_STAGE_ALL_GRAPHICS);
+    return true;
   }
   
   
@@ -5955,8 +6315,10 @@ namespace dxvk {
         return false;
     }
     
-    if (m_descriptorState.hasDirtyComputeSets())
-      this->updateComputeShaderResources();
+    if (m_descriptorState.hasDirtyComputeSets()) {
+      if (unlikely(!this->updateComputeShaderResources()))
+        return false;
+    }
 
     if (m_flags.test(DxvkContextFlag::DirtyPushConstants))
       this->updatePushConstants<VK_PIPELINE_BIND_POINT_COMPUTE>();
@@ -6019,8 +6381,10 @@ namespace dxvk {
         return false;
     }
     
-    if (m_descriptorState.hasDirtyGraphicsSets())
-      this->updateGraphicsShaderResources();
+    if (m_descriptorState.hasDirtyGraphicsSets()) {
+      if (unlikely(!this->updateGraphicsShaderResources()))
+        return false;
+    }
     
     if (m_state.gp.flags.test(DxvkGraphicsPipelineFlag::HasTransformFeedback))
       this->updateTransformFeedbackState();
@@ -6391,6 +6755,55 @@ namespace dxvk {
     this->invalidateBuffer(buffer, buffer->allocSlice());
     return true;
   }
+
+
+  bool DxvkContext::tryHoistBufferTransfer(
+    const Rc<DxvkBuffer>&           dstBuffer,
+    const DxvkBuffer*               srcBuffer) {
+    // Sparse buffers may have pending page table updates
+    if (dstBuffer->info().flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT)
+      return false;
+
+    return this->tryHoistTransfer(dstBuffer.ptr(), srcBuffer);
+  }
+
+
+  bool DxvkContext::tryHoistImageTransfer(
+    const Rc<DxvkImage>&            dstImage,
+    const DxvkBuffer*               srcBuffer) {
+    // Images that can be used as attachments may not be in their
+    // default layout, or may have pending clears, so ignore them
+    if (dstImage->info().usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT))
+      return false;
+
+    if (dstImage->info().flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT)
+      return false;
+
+    return this->tryHoistTransfer(dstImage.ptr(), srcBuffer);
+  }
+
+
+  bool DxvkContext::tryHoistTransfer(
+    const DxvkResource*             dstResource,
+    const DxvkResource*             srcResource) {
+    // Only bother if we would otherwise have to end the render pass
+    if (!m_flags.test(DxvkContextFlag::GpRenderPassBound))
+      return false;
+
+    // The init command buffer executes before anything else in the
+    // current submission, so the destination must not be accessed,
+    // and the source must not be written, by any prior command.
+    uint64_t submission = m_cmd->getSubmissionId();
+
+    if (dstResource->isUsedBySubmission(submission, DxvkAccess::Read))
+      return false;
+
+    if (srcResource && srcResource->isUsedBySubmission(submission, DxvkAccess::Write))
+      return false;
+
+    m_cmd->addStatCtr(DxvkStatCounter::CmdHoistedTransferCount, 1);
+    return true;
+  }
   
 
   DxvkGraphicsPipeline* DxvkContext::lookupGraphicsPipeline(
@@ -6481,7 +6894,8 @@ namespace dxvk {
       DxvkContextFlag::GpDirtyDepthBounds,
       DxvkContextFlag::GpDirtyDepthStencilState,
       DxvkContextFlag::CpDirtyPipelineState,
-      DxvkContextFlag::DirtyDrawBuffer);
+      DxvkContextFlag::DirtyDrawBuffer,
+      DxvkContextFlag::DirtyDescriptorBuffer);
 
     m_descriptorState.dirtyStages(
       VK_SHADER_STAGE_ALL_GRAPHICS |
@@ -6489,6 +6903,49 @@ namespace dxvk {
 
     m_state.gp.pipeline = nullptr;
     m_state.cp.pipeline = nullptr;
+
+    m_initEventWork = this->getExecWorkCount();
+  }
+
+
+  void DxvkContext::prepareInitCommands() {
+    // Only the first upload of each submission can decide where
+    // the execution command buffer waits for the init commands,
+    // since any later command may already consume the upload.
+    if (!m_features.test(DxvkContextFeature::SplitBarriers)
+     || m_initEvent.event || m_initBarriers.hasResourceBarriers())
+      return;
+
+    // Waiting is only useful if there is enough prior work in
+    // the execution command buffer that can overlap with the
+    // uploads, and cannot happen inside a render pass instance.
+    if (m_flags.test(DxvkContextFlag::GpRenderPassBound)
+     || this->getExecWorkCount() < m_initEventWork + MinSplitBarrierWork)
+      return;
+
+    m_initEvent = m_common->eventPool().allocEvent();
+
+    if (!m_initEvent.event)
+      return;
+
+    VkDependencyInfo depInfo = { VK_STRUCTURE_TYPE_DEPENDENCY_INFO };
+    depInfo.memoryBarrierCount = 1;
+    depInfo.pMemoryBarriers = &m_initEventBarrier;
+
+    // Events from the pool may still be signaled, and the init
+    // command buffer gets submitted before the execution one.
+    m_cmd->cmdResetEvent(DxvkCmdBuffer::InitBuffer,
+      m_initEvent.event, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    m_cmd->cmdWaitEvent(DxvkCmdBuffer::ExecBuffer,
+      m_initEvent.event, &depInfo);
+  }
+
+
+  uint64_t DxvkContext::getExecWorkCount() {
+    const auto& counters = m_cmd->statCounters();
+
+    return counters.getCtr(DxvkStatCounter::CmdDrawCalls)
+         + counters.getCtr(DxvkStatCounter::CmdDispatchCalls);
   }
 
 
@@ -6496,8 +6953,30 @@ namespace dxvk {
     this->spillRenderPass(true);
     this->flushSharedImages();
 
+    if (m_queryManager.resolveQueries(m_cmd)) {
+      emitMemoryBarrier(
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_ACCESS_TRANSFER_WRITE_BIT,
+        VK_PIPELINE_STAGE_HOST_BIT,
+        VK_ACCESS_HOST_READ_BIT);
+    }
+
     m_sdmaBarriers.finalize(m_cmd);
-    m_initBarriers.finalize(m_cmd);
+
+    if (m_initEvent.event) {
+      VkDependencyInfo depInfo = { VK_STRUCTURE_TYPE_DEPENDENCY_INFO };
+      depInfo.memoryBarrierCount = 1;
+      depInfo.pMemoryBarriers = &m_initEventBarrier;
+
+      if (m_initBarriers.finalizeSplit(m_cmd, m_initEvent.event, depInfo))
+        m_cmd->addStatCtr(DxvkStatCounter::CmdSplitBarrierCount, 1);
+
+      m_cmd->trackGpuEvent(m_initEvent);
+      m_initEvent = DxvkGpuEventHandle();
+    } else {
+      m_initBarriers.finalize(m_cmd);
+    }
+
     m_execBarriers.finalize(m_cmd);
   }
 
@@ -22,6 +22,7 @@ namespace dxvk {
    */
   class DxvkContext : public RcObject {
     constexpr static VkDeviceSize StagingBufferSize = 4ull << 20;
+    constexpr static uint64_t     MinSplitBarrierWork = 8;
   public:
     
     DxvkContext(const Rc<DxvkDevice>& device, DxvkContextType type);
@@ -531,6 +532,24 @@ namespace dxvk {
             VkDeviceSize          srcOffset,
             VkDeviceSize          rowAlignment,
             VkDeviceSize          sliceAlignment);
+
+    /**
+     * \brief Copies multiple buffer regions to an image
+     *
+     * Records a single copy command for all regions. Each region
+     * must cover exactly one aspect and array layer, and buffer data
+     * must be tightly packed. Regions must not overlap each other.
+     * \param [in] dstImage Destination image
+     * \param [in] srcBuffer Source buffer
+     * \param [in] regionCount Number of regions
+     * \param [in] pRegions Copy regions. Buffer offsets
+     *    are relative to the start of the source buffer.
+     */
+    void copyBufferToImageRegions(
+      const Rc<DxvkImage>&        dstImage,
+      const Rc<DxvkBuffer>&       srcBuffer,
+            uint32_t              regionCount,
+      const VkBufferImageCopy*    pRegions);
     
     /**
      * \brief Copies data from one image to another
@@ -1404,6 +1423,8 @@ namespace dxvk {
 
     Rc<DxvkDescriptorPool>  m_descriptorPool;
     Rc<DxvkDescriptorManager> m_descriptorManager;
+    Rc<DxvkDescriptorBuffer> m_descriptorBuffer;
+    DxvkDescriptorSetKey    m_descriptorSetKey;
 
     DxvkBarrierSet          m_sdmaAcquires;
     DxvkBarrierSet          m_sdmaBarriers;
@@ -1412,6 +1433,10 @@ namespace dxvk {
     DxvkBarrierSet          m_execBarriers;
     DxvkBarrierControlFlags m_barrierControl;
 
+    DxvkGpuEventHandle      m_initEvent;
+    VkMemoryBarrier2        m_initEventBarrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER_2 };
+    uint64_t                m_initEventWork = 0;
+
     DxvkGpuQueryManager     m_queryManager;
     DxvkStagingBuffer       m_staging;
     
@@ -1631,10 +1656,29 @@ namespace dxvk {
     void invalidateState();
 
     template<VkPipelineBindPoint BindPoint>
-    void updateResourceBindings(const DxvkBindingLayoutObjects* layout);
+    bool updateResourceBindings(const DxvkBindingLayoutObjects* layout);
+
+    void bindMetaDescriptors(
+            VkPipelineBindPoint       bindPoint,
+            VkPipelineLayout          pipelineLayout,
+            VkDescriptorSetLayout     setLayout,
+            uint32_t                  descriptorWriteCount,
+            VkWriteDescriptorSet*     descriptorWrites);
+
+    void bindMetaDescriptorsWithTemplate(
+            VkPipelineBindPoint       bindPoint,
+            VkPipelineLayout          pipelineLayout,
+            VkDescriptorSetLayout     setLayout,
+            VkDescriptorUpdateTemplate descriptorTemplate,
+      const void*                     data);
+
+    void writeDescriptor(
+      const DxvkBindingInfo&          binding,
+      const DxvkDescriptorInfo&       descriptorInfo,
+            void*                     dst);
 
-    void updateComputeShaderResources();
-    void updateGraphicsShaderResources();
+    bool updateComputeShaderResources();
+    bool updateGraphicsShaderResources();
 
     DxvkFramebufferInfo makeFramebufferInfo(
       const DxvkRenderTargets&      renderTargets);
@@ -1722,6 +1766,18 @@ namespace dxvk {
       const Rc<DxvkBuffer>&           buffer,
             VkDeviceSize              copySize);
 
+    bool tryHoistBufferTransfer(
+      const Rc<DxvkBuffer>&           dstBuffer,
+      const DxvkBuffer*               srcBuffer);
+
+    bool tryHoistImageTransfer(
+      const Rc<DxvkImage>&            dstImage,
+      const DxvkBuffer*               srcBuffer);
+
+    bool tryHoistTransfer(
+      const DxvkResource*             dstResource,
+      const DxvkResource*             srcResource);
+
     DxvkGraphicsPipeline* lookupGraphicsPipeline(
       const DxvkGraphicsPipelineShaders&  shaders);
 
@@ -1736,6 +1792,10 @@ namespace dxvk {
 
     void beginCurrentCommands();
 
+    void prepareInitCommands();
+
+    uint64_t getExecWorkCount();
+
     void endCurrentCommands();
 
     void splitCommands();
@@ -54,6 +54,7 @@ namespace dxvk {
     
     DirtyDrawBuffer,            ///< Indirect argument buffer is dirty
     DirtyPushConstants,         ///< Push constant data has changed
+    DirtyDescriptorBuffer,      ///< Descriptor buffer needs to be bound
   };
   
   using DxvkContextFlags = Flags<DxvkContextFlag>;
@@ -66,6 +67,10 @@ namespace dxvk {
     TrackGraphicsPipeline,
     VariableMultisampleRate,
     IndexBufferRobustness,
+    SplitBarriers,
+    DescriptorBuffer,
+    PushDescriptors,
+    AsyncTransfer,
     FeatureCount
   };
 
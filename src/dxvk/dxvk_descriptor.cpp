@@ -1,4 +1,5 @@
 #include "dxvk_descriptor.h"
+#include "dxvk_descriptor_buffer.h"
 #include "dxvk_device.h"
 
 namespace dxvk {
@@ -99,6 +100,47 @@ namespace dxvk {
   }
 
 
+  VkDescriptorSet DxvkDescriptorPool::lookupSet(
+    const DxvkDescriptorSetKey&     key) {
+    m_setCacheLookups += 1;
+
+    auto entry = m_setCache.find(key);
+
+    if (entry == m_setCache.end())
+      return VK_NULL_HANDLE;
+
+    m_setCacheHits += 1;
+    return entry->second;
+  }
+
+
+  VkDescriptorSet DxvkDescriptorPool::allocCached(
+    const DxvkBindingLayoutObjects* layout,
+          uint32_t                  setIndex,
+    const DxvkDescriptorSetKey&     key) {
+    auto setMap = getSetMapCached(layout);
+
+    VkDescriptorSet set = allocSet(
+      setMap->sets[setIndex],
+      layout->getSetLayout(setIndex));
+
+    m_setsUsed += 1;
+
+    // Keep the cache small, most hits come from
+    // consecutive draws with identical bindings
+    if (m_setCache.size() >= MaxCachedSetCount)
+      m_setCache.clear();
+
+    m_setCache.insert({ key, set });
+    return set;
+  }
+
+
+  void DxvkDescriptorPool::clearSetCache() {
+    m_setCache.clear();
+  }
+
+
   void DxvkDescriptorPool::reset() {
     // As a heuristic to save memory, check how many descriptor
     // sets were actually being used in past submissions.
@@ -112,6 +154,8 @@ namespace dxvk {
 
     m_setsUsed = 0;
 
+    m_setCache.clear();
+
     if (!needsReset) {
       for (auto& entry : m_setLists)
         entry.second.reset();
@@ -137,9 +181,14 @@ namespace dxvk {
     if (m_contextType == DxvkContextType::Primary) {
       counters.addCtr(DxvkStatCounter::DescriptorSetCount,
         uint64_t(int64_t(m_setsAllocated) - int64_t(m_prevSetsAllocated)));
+      counters.addCtr(DxvkStatCounter::DescriptorSetLookups, m_setCacheLookups);
+      counters.addCtr(DxvkStatCounter::DescriptorSetReuses, m_setCacheHits);
     }
 
     m_prevSetsAllocated = m_setsAllocated;
+
+    m_setCacheLookups = 0;
+    m_setCacheHits = 0;
   }
 
 
@@ -245,6 +294,28 @@ namespace dxvk {
     m_maxSets = m_contextType == DxvkContextType::Primary
       ? (env::is32BitHostPlatform() ? 24576u : 49152u)
       : (512u);
+
+    if (m_device->canUseDescriptorBuffer()) {
+      const auto& properties = m_device->properties().extDescriptorBuffer;
+      bool robust = m_device->features().core.features.robustBufferAccess;
+
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_SAMPLER]                = properties.samplerDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER] = properties.combinedImageSamplerDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE]          = properties.sampledImageDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_STORAGE_IMAGE]          = properties.storageImageDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER]   = robust
+        ? properties.robustUniformTexelBufferDescriptorSize
+        : properties.uniformTexelBufferDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER]   = robust
+        ? properties.robustStorageTexelBufferDescriptorSize
+        : properties.storageTexelBufferDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER]         = robust
+        ? properties.robustUniformBufferDescriptorSize
+        : properties.uniformBufferDescriptorSize;
+      m_descriptorSizes[VK_DESCRIPTOR_TYPE_STORAGE_BUFFER]         = robust
+        ? properties.robustStorageBufferDescriptorSize
+        : properties.storageBufferDescriptorSize;
+    }
   }
 
 
@@ -279,6 +350,24 @@ namespace dxvk {
   }
 
 
+  Rc<DxvkDescriptorBuffer> DxvkDescriptorManager::getDescriptorBuffer() {
+    Rc<DxvkDescriptorBuffer> buffer = m_buffers.retrieveObject();
+
+    if (buffer == nullptr)
+      buffer = new DxvkDescriptorBuffer(m_device, m_contextType);
+
+    return buffer;
+  }
+
+
+  void DxvkDescriptorManager::recycleDescriptorBuffer(
+    const Rc<DxvkDescriptorBuffer>&   buffer) {
+    buffer->reset();
+
+    m_buffers.returnObject(buffer);
+  }
+
+
   VkDescriptorPool DxvkDescriptorManager::createVulkanDescriptorPool() {
     auto vk = m_device->vkd();
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
+#include "dxvk_hash.h"
 #include "dxvk_include.h"
 #include "dxvk_pipelayout.h"
 #include "dxvk_recycler.h"
@@ -10,6 +13,7 @@
 namespace dxvk {
 
   class DxvkDevice;
+  class DxvkDescriptorBuffer;
   class DxvkDescriptorManager;
   
   /**
@@ -59,6 +63,98 @@ namespace dxvk {
   };
 
 
+  /**
+   * \brief Descriptor set key
+   *
+   * Stores the packed contents of a descriptor set along
+   * with its layout, so that sets with identical contents
+   * can be reused rather than allocated and written again.
+   * Only the fields relevant for each descriptor type are
+   * stored, so that unused union members do not matter.
+   */
+  class DxvkDescriptorSetKey {
+
+  public:
+
+    /**
+     * \brief Resets key for the given set layout
+     * \param [in] layout Descriptor set layout
+     */
+    void reset(VkDescriptorSetLayout layout) {
+      m_layout = layout;
+      m_data.clear();
+    }
+
+    /**
+     * \brief Adds a descriptor
+     *
+     * \param [in] type Descriptor type
+     * \param [in] info Descriptor info
+     */
+    void add(VkDescriptorType type, const DxvkDescriptorInfo& info) {
+      switch (type) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+          addHandle(info.image.sampler);
+          break;
+
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+          addHandle(info.image.sampler);
+          [[fallthrough]];
+
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+          addHandle(info.image.imageView);
+          m_data.push_back(uint64_t(info.image.imageLayout));
+          break;
+
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+          addHandle(info.texelBuffer);
+          break;
+
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+          addHandle(info.buffer.buffer);
+          m_data.push_back(info.buffer.offset);
+          m_data.push_back(info.buffer.range);
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    bool eq(const DxvkDescriptorSetKey& other) const {
+      return m_layout == other.m_layout
+          && m_data.size() == other.m_data.size()
+          && !std::memcmp(m_data.data(), other.m_data.data(), m_data.size() * sizeof(uint64_t));
+    }
+
+    size_t hash() const {
+      DxvkHashState hash;
+      hash.add(std::hash<VkDescriptorSetLayout>()(m_layout));
+
+      for (uint64_t data : m_data)
+        hash.add(std::hash<uint64_t>()(data));
+
+      return hash;
+    }
+
+  private:
+
+    VkDescriptorSetLayout m_layout = VK_NULL_HANDLE;
+    std::vector<uint64_t> m_data;
+
+    template<typename T>
+    void addHandle(T handle) {
+      uint64_t value = 0;
+      std::memcpy(&value, &handle, sizeof(handle));
+      m_data.push_back(value);
+    }
+
+  };
+
+
   /**
    * \brief Persistent descriptor set map
    *
@@ -81,6 +177,7 @@ namespace dxvk {
    */
   class DxvkDescriptorPool : public RcObject {
     constexpr static uint32_t MaxDesiredPoolCount = 2;
+    constexpr static uint32_t MaxCachedSetCount   = 1024;
   public:
 
     DxvkDescriptorPool(
@@ -119,6 +216,42 @@ namespace dxvk {
     VkDescriptorSet alloc(
             VkDescriptorSetLayout     layout);
 
+    /**
+     * \brief Looks up a previously written descriptor set
+     *
+     * Sets returned by this function must not be updated.
+     * \param [in] key Descriptor set layout and contents
+     * \returns Matching set, or \c VK_NULL_HANDLE if none
+     */
+    VkDescriptorSet lookupSet(
+      const DxvkDescriptorSetKey&     key);
+
+    /**
+     * \brief Allocates a descriptor set for reuse
+     *
+     * The returned set must be updated with the
+     * contents described by the given key before
+     * it is used, and must not be modified later.
+     * \param [in] layout Binding layout
+     * \param [in] setIndex Descriptor set index
+     * \param [in] key Descriptor set contents
+     * \returns The descriptor set
+     */
+    VkDescriptorSet allocCached(
+      const DxvkBindingLayoutObjects* layout,
+            uint32_t                  setIndex,
+      const DxvkDescriptorSetKey&     key);
+
+    /**
+     * \brief Clears descriptor set cache
+     *
+     * Must be called when starting a new command list,
+     * since resources referenced by cached sets are only
+     * guaranteed to stay alive for the command list that
+     * the sets were written in.
+     */
+    void clearSetCache();
+
     /**
      * \brief Resets pool
      */
@@ -155,6 +288,14 @@ namespace dxvk {
 
     uint32_t m_prevSetsAllocated = 0;
 
+    std::unordered_map<
+      DxvkDescriptorSetKey,
+      VkDescriptorSet,
+      DxvkHash, DxvkEq>       m_setCache;
+
+    uint32_t m_setCacheLookups  = 0;
+    uint32_t m_setCacheHits     = 0;
+
     DxvkDescriptorSetMap* getSetMapCached(
       const DxvkBindingLayoutObjects*           layout);
 
@@ -212,6 +353,31 @@ namespace dxvk {
     void recycleDescriptorPool(
       const Rc<DxvkDescriptorPool>&     pool);
 
+    /**
+     * \brief Retrieves or creates a descriptor buffer
+     * \returns The descriptor buffer
+     */
+    Rc<DxvkDescriptorBuffer> getDescriptorBuffer();
+
+    /**
+     * \brief Recycles descriptor buffer
+     *
+     * Resets and recycles the given
+     * descriptor buffer for future use.
+     */
+    void recycleDescriptorBuffer(
+      const Rc<DxvkDescriptorBuffer>&   buffer);
+
+    /**
+     * \brief Queries descriptor size for descriptor buffers
+     *
+     * \param [in] type Descriptor type
+     * \returns Size of a single descriptor, in bytes
+     */
+    size_t getDescriptorSize(VkDescriptorType type) const {
+      return m_descriptorSizes[uint32_t(type)];
+    }
+
     /**
      * \brief Creates a Vulkan descriptor pool
      *
@@ -237,6 +403,9 @@ namespace dxvk {
     DxvkContextType                     m_contextType;
     uint32_t                            m_maxSets = 0;
     DxvkRecycler<DxvkDescriptorPool, 8> m_pools;
+    DxvkRecycler<DxvkDescriptorBuffer, 8> m_buffers;
+
+    std::array<size_t, 8>               m_descriptorSizes = { };
 
     dxvk::mutex                         m_mutex;
     std::array<VkDescriptorPool, 8>     m_vkPools;
@@ -0,0 +1,85 @@
+#include "dxvk_descriptor_buffer.h"
+#include "dxvk_device.h"
+
+namespace dxvk {
+
+  DxvkDescriptorBuffer::DxvkDescriptorBuffer(
+          DxvkDevice*               device,
+          DxvkContextType           contextType)
+  : m_contextType(contextType) {
+    const auto& properties = device->properties().extDescriptorBuffer;
+
+    // Pick a size large enough for a few thousand draws on the primary
+    // context, but respect the maximum range that can be bound at once
+    VkDeviceSize size = contextType == DxvkContextType::Primary
+      ? VkDeviceSize(8u << 20)
+      : VkDeviceSize(256u << 10);
+
+    size = std::min(size, properties.maxResourceDescriptorBufferRange);
+    size = std::min(size, properties.maxSamplerDescriptorBufferRange);
+
+    DxvkBufferCreateInfo info;
+    info.size   = size;
+    info.usage  = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT
+                | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT
+                | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    info.stages = device->getShaderPipelineStages();
+    info.access = VK_ACCESS_SHADER_READ_BIT;
+
+    m_buffer = device->createBuffer(info,
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+    m_alignment = properties.descriptorBufferOffsetAlignment;
+  }
+
+
+  DxvkDescriptorBuffer::~DxvkDescriptorBuffer() {
+
+  }
+
+
+  VkDescriptorBufferBindingInfoEXT DxvkDescriptorBuffer::getBindingInfo() const {
+    VkDescriptorBufferBindingInfoEXT result = { VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT };
+    result.address = m_buffer->getSliceHandle().gpuAddress;
+    result.usage = m_buffer->info().usage;
+    return result;
+  }
+
+
+  bool DxvkDescriptorBuffer::shouldSubmit(bool endFrame) const {
+    // Never submit empty descriptor buffers
+    if (!m_offset)
+      return false;
+
+    // No frame tracking for supplementary contexts, so
+    // always submit those at the end of a command list
+    return endFrame || m_contextType != DxvkContextType::Primary;
+  }
+
+
+  bool DxvkDescriptorBuffer::alloc(
+    const DxvkBindingLayoutObjects* layout,
+          uint32_t                  setMask,
+          VkDeviceSize*             offsets) {
+    VkDeviceSize offset = m_offset;
+
+    for (auto setIndex : bit::BitMask(setMask)) {
+      offsets[setIndex] = offset;
+      offset += align(layout->getSetLayoutObjects(setIndex)->getDescriptorSize(), m_alignment);
+    }
+
+    if (offset > m_buffer->info().size)
+      return false;
+
+    m_offset = offset;
+    return true;
+  }
+
+
+  void DxvkDescriptorBuffer::reset() {
+    m_offset = 0;
+  }
+
+}
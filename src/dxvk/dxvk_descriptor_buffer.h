@@ -0,0 +1,81 @@
+#pragma once
+
+#include "dxvk_buffer.h"
+#include "dxvk_descriptor.h"
+
+namespace dxvk {
+
+  /**
+   * \brief Descriptor buffer
+   *
+   * Linear allocator for descriptor memory that is written
+   * directly by the host. Replaces descriptor pools for shader
+   * resources if descriptor buffers are enabled, and follows the
+   * same lifetime rules, i.e. the buffer is only reset once the
+   * last command list that used it has completed execution.
+   */
+  class DxvkDescriptorBuffer : public RcObject {
+
+  public:
+
+    DxvkDescriptorBuffer(
+            DxvkDevice*               device,
+            DxvkContextType           contextType);
+
+    ~DxvkDescriptorBuffer();
+
+    /**
+     * \brief Queries binding info
+     * \returns Binding info for the descriptor buffer
+     */
+    VkDescriptorBufferBindingInfoEXT getBindingInfo() const;
+
+    /**
+     * \brief Retrieves pointer to descriptor memory
+     *
+     * \param [in] offset Offset returned by \ref alloc
+     * \returns Pointer to mapped descriptor memory
+     */
+    char* mapPtr(VkDeviceSize offset) const {
+      return reinterpret_cast<char*>(m_buffer->mapPtr(offset));
+    }
+
+    /**
+     * \brief Tests whether the descriptor buffer should be replaced
+     *
+     * \param [in] endFrame Whether this is the end of the frame
+     * \returns \c true if the buffer should be submitted
+     */
+    bool shouldSubmit(bool endFrame) const;
+
+    /**
+     * \brief Allocates memory for one or multiple descriptor sets
+     *
+     * Either allocates memory for all given sets, or fails
+     * if there is not enough memory left in the buffer.
+     * \param [in] layout Binding layout
+     * \param [in] setMask Descriptor set mask
+     * \param [out] offsets Descriptor set offsets
+     * \returns \c true on success
+     */
+    bool alloc(
+      const DxvkBindingLayoutObjects* layout,
+            uint32_t                  setMask,
+            VkDeviceSize*             offsets);
+
+    /**
+     * \brief Resets descriptor buffer
+     */
+    void reset();
+
+  private:
+
+    Rc<DxvkBuffer>  m_buffer;
+
+    DxvkContextType m_contextType;
+    VkDeviceSize    m_alignment = 0;
+    VkDeviceSize    m_offset    = 0;
+
+  };
+
+}
@@ -57,6 +57,15 @@ namespace dxvk {
   }
 
 
+  bool DxvkDevice::canUseDescriptorBuffer() const {
+    // The feature is only ever enabled if requested in the config
+    // file, but imported devices may have enabled it regardless
+    return m_features.extDescriptorBuffer.descriptorBuffer
+        && m_features.vk12.bufferDeviceAddress
+        && m_options.enableDescriptorBuffer;
+  }
+
+
   bool DxvkDevice::canUsePipelineCacheControl() const {
     // Don't bother with this unless the device also supports shader module
     // identifiers, since decoding and hashing the shaders is slow otherwise
@@ -160,7 +169,7 @@ namespace dxvk {
   Rc<DxvkBuffer> DxvkDevice::createBuffer(
     const DxvkBufferCreateInfo& createInfo,
           VkMemoryPropertyFlags memoryType) {
-    return new DxvkBuffer(this, createInfo, m_objects.memoryManager(), memoryType);
+    return new DxvkBuffer(this, createInfo, m_objects.memoryManager(), m_objects.bufferArena(), memoryType);
   }
   
   
@@ -134,6 +134,18 @@ namespace dxvk {
       return m_queues.transfer.queueHandle
           != m_queues.graphics.queueHandle;
     }
+
+    /**
+     * \brief Checks whether async transfers can be used
+     *
+     * Requires a dedicated transfer queue, and the feature
+     * must be explicitly enabled in the configuration.
+     * \returns \c true if async transfers can be used
+     */
+    bool canUseAsyncTransfer() const {
+      return m_options.enableAsyncTransfer
+          && hasDedicatedTransferQueue();
+    }
     
     /**
      * \brief The instance
@@ -219,6 +231,52 @@ namespace dxvk {
      */
     bool canUseGraphicsPipelineLibrary() const;
 
+    /**
+     * \brief Checks whether descriptor buffers can be used
+     *
+     * If this returns \c true, shader pipelines use descriptor
+     * buffers instead of descriptor sets, and all buffers that
+     * can be bound to shaders will have a device address.
+     * \returns \c true if descriptor buffers are enabled
+     */
+    bool canUseDescriptorBuffer() const;
+
+    /**
+     * \brief Queries pipeline create flags for shader pipelines
+     *
+     * Returns flags that must be set for all pipelines and
+     * pipeline libraries using shader binding layouts.
+     * \returns Pipeline create flags
+     */
+    VkPipelineCreateFlags getShaderPipelineCreateFlags() const {
+      return canUseDescriptorBuffer()
+        ? VkPipelineCreateFlags(VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT)
+        : VkPipelineCreateFlags(0);
+    }
+
+    /**
+     * \brief Checks whether meta pipelines use push descriptors
+     *
+     * Internal pipelines only use a handful of descriptors, which
+     * is well below the guaranteed push descriptor limit, so they
+     * can skip descriptor set allocation entirely if supported.
+     * \returns \c true if push descriptors are supported
+     */
+    bool canUseMetaPushDescriptors() const {
+      return m_features.khrPushDescriptor
+          && m_properties.khrPushDescriptor.maxPushDescriptors >= MaxNumMetaDescriptors;
+    }
+
+    /**
+     * \brief Queries descriptor set layout flags for meta pipelines
+     * \returns Descriptor set layout create flags
+     */
+    VkDescriptorSetLayoutCreateFlags getMetaDescriptorSetLayoutFlags() const {
+      return canUseMetaPushDescriptors()
+        ? VkDescriptorSetLayoutCreateFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+        : VkDescriptorSetLayoutCreateFlags(0);
+    }
+
     /**
      * \brief Checks whether pipeline creation cache control can be used
      * \returns \c true if all required features are supported.
@@ -509,6 +567,17 @@ namespace dxvk {
       m_statCounters.addCtr(counter, value);
     }
 
+    /**
+     * \brief Decrements a given stat counter
+     *
+     * \param [in] counter Stat counter to decrement
+     * \param [in] value Decrement value
+     */
+    void subStatCtr(DxvkStatCounter counter, uint64_t value) {
+      std::lock_guard<sync::Spinlock> lock(m_statLock);
+      m_statCounters.subCtr(counter, value);
+    }
+
     /**
      * \brief Waits for a given submission
      * 
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstring>
 
 #include "dxvk_cmdlist.h"
 #include "dxvk_device.h"
@@ -93,16 +94,13 @@ namespace dxvk {
     const DxvkGpuQueryHandle& handle) {
     DxvkQueryData tmpData = { };
 
-    // Try to copy query data to temporary structure
-    VkResult result = m_vkd->vkGetQueryPoolResults(m_vkd->device(),
-      handle.queryPool, handle.queryId, 1,
-      sizeof(DxvkQueryData), &tmpData,
-      sizeof(DxvkQueryData), VK_QUERY_RESULT_64_BIT);
-    
-    if (result == VK_NOT_READY)
+    // Results get copied to the result buffer at the end of the
+    // command list, and become visible once it has completed.
+    if (!handle.resultStatus || !handle.resultStatus->load(std::memory_order_acquire))
       return DxvkGpuQueryStatus::Pending;
-    else if (result != VK_SUCCESS)
-      return DxvkGpuQueryStatus::Failed;
+
+    std::memcpy(&tmpData, handle.resultData,
+      handle.allocator->resultSize());
     
     // Add numbers to the destination structure
     switch (m_type) {
@@ -182,15 +180,16 @@ namespace dxvk {
   : m_device        (device),
     m_vkd           (device->vkd()),
     m_queryType     (queryType),
-    m_queryPoolSize (queryPoolSize) {
+    m_queryPoolSize (queryPoolSize),
+    m_resultSize    (getResultSize(queryType)) {
 
   }
 
   
   DxvkGpuQueryAllocator::~DxvkGpuQueryAllocator() {
-    for (VkQueryPool pool : m_pools) {
+    for (const auto& pool : m_pools) {
       m_vkd->vkDestroyQueryPool(
-        m_vkd->device(), pool, nullptr);
+        m_vkd->device(), pool.queryPool, nullptr);
     }
   }
 
@@ -206,6 +205,8 @@ namespace dxvk {
     
     DxvkGpuQueryHandle result = m_handles.back();
     m_handles.pop_back();
+
+    result.resultStatus->store(0, std::memory_order_relaxed);
     return result;
   }
 
@@ -243,10 +244,54 @@ namespace dxvk {
       return;
     }
 
-    m_pools.push_back(queryPool);
+    // Create a host-readable buffer that receives the results of
+    // all queries in the pool, so that reading back results does
+    // not require any Vulkan calls on the application thread.
+    DxvkBufferCreateInfo bufferInfo;
+    bufferInfo.size   = m_resultSize * m_queryPoolSize;
+    bufferInfo.usage  = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    bufferInfo.stages = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    bufferInfo.access = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    Pool& pool = m_pools.emplace_back();
+    pool.queryPool    = queryPool;
+    pool.resultBuffer = m_device->createBuffer(bufferInfo,
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+      VK_MEMORY_PROPERTY_HOST_COHERENT_BIT |
+      VK_MEMORY_PROPERTY_HOST_CACHED_BIT);
+    pool.resultStatus = std::make_unique<std::atomic<uint32_t>[]>(m_queryPoolSize);
+
+    DxvkBufferSliceHandle slice = pool.resultBuffer->getSliceHandle();
+
+    for (uint32_t i = 0; i < m_queryPoolSize; i++) {
+      DxvkGpuQueryHandle handle;
+      handle.allocator    = this;
+      handle.queryPool    = queryPool;
+      handle.queryId      = i;
+      handle.resultBuffer = slice.handle;
+      handle.resultOffset = slice.offset + m_resultSize * i;
+      handle.resultData   = reinterpret_cast<const char*>(slice.mapPtr) + m_resultSize * i;
+      handle.resultStatus = &pool.resultStatus[i];
 
-    for (uint32_t i = 0; i < m_queryPoolSize; i++)
-      m_handles.push_back({ this, queryPool, i });
+      m_handles.push_back(handle);
+    }
+  }
+
+
+  VkDeviceSize DxvkGpuQueryAllocator::getResultSize(
+          VkQueryType         queryType) {
+    switch (queryType) {
+      case VK_QUERY_TYPE_OCCLUSION:
+        return sizeof(DxvkQueryOcclusionData);
+      case VK_QUERY_TYPE_TIMESTAMP:
+        return sizeof(DxvkQueryTimestampData);
+      case VK_QUERY_TYPE_PIPELINE_STATISTICS:
+        return sizeof(DxvkQueryStatisticData);
+      case VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT:
+        return sizeof(DxvkQueryXfbStreamData);
+      default:
+        return sizeof(DxvkQueryData);
+    }
   }
 
 
@@ -345,6 +390,9 @@ namespace dxvk {
       handle.queryId);
     
     cmd->trackResource<DxvkAccess::None>(query);
+
+    if (handle.queryPool)
+      m_pendingQueries.push_back(handle);
   }
 
 
@@ -415,6 +463,50 @@ namespace dxvk {
     }
 
     cmd->trackResource<DxvkAccess::None>(query);
+
+    if (handle.queryPool)
+      m_pendingQueries.push_back(handle);
+  }
+
+
+  bool DxvkGpuQueryManager::resolveQueries(
+    const Rc<DxvkCommandList>&  cmd) {
+    if (m_pendingQueries.empty())
+      return false;
+
+    // Sort queries so that consecutive queries from the
+    // same pool can be copied with a single command
+    std::sort(m_pendingQueries.begin(), m_pendingQueries.end(),
+      [] (const DxvkGpuQueryHandle& a, const DxvkGpuQueryHandle& b) {
+        if (a.queryPool != b.queryPool)
+          return std::less<VkQueryPool>()(a.queryPool, b.queryPool);
+        return a.queryId < b.queryId;
+      });
+
+    size_t first = 0;
+
+    for (size_t i = 1; i <= m_pendingQueries.size(); i++) {
+      const auto& head = m_pendingQueries[first];
+
+      if (i < m_pendingQueries.size()
+       && m_pendingQueries[i].queryPool == head.queryPool
+       && m_pendingQueries[i].queryId == head.queryId + (i - first))
+        continue;
+
+      cmd->cmdCopyQueryPoolResults(head.queryPool,
+        head.queryId, uint32_t(i - first),
+        head.resultBuffer, head.resultOffset,
+        head.allocator->resultSize(),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+
+      first = i;
+    }
+
+    for (const auto& handle : m_pendingQueries)
+      cmd->trackGpuQueryResolve(handle);
+
+    m_pendingQueries.clear();
+    return true;
   }
   
   
@@ -442,11 +534,25 @@ namespace dxvk {
   }
 
 
+  void DxvkGpuQueryTracker::trackResolve(DxvkGpuQueryHandle handle) {
+    m_resolved.push_back(handle);
+  }
+
+
+  void DxvkGpuQueryTracker::notify() {
+    for (const auto& handle : m_resolved)
+      handle.resultStatus->store(1, std::memory_order_release);
+
+    m_resolved.clear();
+  }
+
+
   void DxvkGpuQueryTracker::reset() {
     for (DxvkGpuQueryHandle handle : m_handles)
       handle.allocator->freeQuery(handle);
     
     m_handles.clear();
+    m_resolved.clear();
   }
 
 }
\ No newline at end of file
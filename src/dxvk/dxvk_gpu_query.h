@@ -6,6 +6,7 @@
 
 #include "../util/util_small_vector.h"
 
+#include "dxvk_buffer.h"
 #include "dxvk_resource.h"
 
 namespace dxvk {
@@ -99,14 +100,19 @@ namespace dxvk {
    * \brief Query handle
    * 
    * Stores the query allocator, as well as
-   * the actual pool and query index. Since
-   * query pools have to be reset on the GPU,
-   * this also comes with a reset event.
+   * the actual pool and query index. Query
+   * results are copied to a mapped buffer at
+   * the end of the command list, and the status
+   * gets set once the command list completes.
    */
   struct DxvkGpuQueryHandle {
-    DxvkGpuQueryAllocator* allocator  = nullptr;
-    VkQueryPool            queryPool  = VK_NULL_HANDLE;
-    uint32_t               queryId    = 0;
+    DxvkGpuQueryAllocator* allocator    = nullptr;
+    VkQueryPool            queryPool    = VK_NULL_HANDLE;
+    uint32_t               queryId      = 0;
+    VkBuffer               resultBuffer = VK_NULL_HANDLE;
+    VkDeviceSize           resultOffset = 0;
+    const void*            resultData   = nullptr;
+    std::atomic<uint32_t>* resultStatus = nullptr;
   };
 
 
@@ -259,6 +265,17 @@ namespace dxvk {
     
     ~DxvkGpuQueryAllocator();
 
+    /**
+     * \brief Size of query results
+     *
+     * This is also the stride between results
+     * of consecutive queries in the result buffer.
+     * \returns Size of a single query result
+     */
+    VkDeviceSize resultSize() const {
+      return m_resultSize;
+    }
+
     /**
      * \brief Allocates a query
      * 
@@ -281,17 +298,27 @@ namespace dxvk {
 
   private:
 
+    struct Pool {
+      VkQueryPool                               queryPool;
+      Rc<DxvkBuffer>                            resultBuffer;
+      std::unique_ptr<std::atomic<uint32_t>[]>  resultStatus;
+    };
+
     DxvkDevice*       m_device;
     Rc<vk::DeviceFn>  m_vkd;
     VkQueryType       m_queryType;
     uint32_t          m_queryPoolSize;
+    VkDeviceSize      m_resultSize;
     
     dxvk::mutex                     m_mutex;
     std::vector<DxvkGpuQueryHandle> m_handles;
-    std::vector<VkQueryPool>        m_pools;
+    std::vector<Pool>               m_pools;
 
     void createQueryPool();
 
+    static VkDeviceSize getResultSize(
+            VkQueryType         queryType);
+
   };
 
 
@@ -400,11 +427,25 @@ namespace dxvk {
       const Rc<DxvkCommandList>&  cmd,
             VkQueryType           type);
 
+    /**
+     * \brief Copies query results to result buffers
+     *
+     * Must be called outside of a render pass, after all
+     * queries of the current command list have ended.
+     * Consecutive queries are copied with one command.
+     * \param [in] cmd Command list
+     * \returns \c true if any results were copied. If so,
+     *    the caller must make transfer writes host-visible.
+     */
+    bool resolveQueries(
+      const Rc<DxvkCommandList>&  cmd);
+
   private:
 
     DxvkGpuQueryPool*             m_pool;
     uint32_t                      m_activeTypes;
     std::vector<Rc<DxvkGpuQuery>> m_activeQueries;
+    std::vector<DxvkGpuQueryHandle> m_pendingQueries;
 
     void beginSingleQuery(
       const Rc<DxvkCommandList>&  cmd,
@@ -439,6 +480,23 @@ namespace dxvk {
      */
     void trackQuery(DxvkGpuQueryHandle handle);
 
+    /**
+     * \brief Tracks a query whose results get copied
+     *
+     * The query result will be marked as available
+     * once the command list has finished executing.
+     * \param [in] handle Query handle
+     */
+    void trackResolve(DxvkGpuQueryHandle handle);
+
+    /**
+     * \brief Marks resolved queries as available
+     *
+     * Must only be called once the command
+     * list has finished executing.
+     */
+    void notify();
+
     /**
      * \brief Recycles all tracked handles
      * 
@@ -450,6 +508,7 @@ namespace dxvk {
   private:
 
     std::vector<DxvkGpuQueryHandle> m_handles;
+    std::vector<DxvkGpuQueryHandle> m_resolved;
 
   };
 }
\ No newline at end of file
@@ -110,6 +110,11 @@ namespace dxvk {
       if (isGpuWritable)
         hints.set(DxvkMemoryFlag::GpuWritable);
 
+      memoryProperties.tag.type   = DxvkMemoryTagType::Image;
+      memoryProperties.tag.usage  = m_info.usage;
+      memoryProperties.tag.format = m_info.format;
+      memoryProperties.tag.object = this;
+
       m_image.memory = memAlloc.alloc(memoryRequirements, memoryProperties, hints);
 
       // Try to bind the allocated memory slice to the image
@@ -134,6 +139,10 @@ namespace dxvk {
 
         DxvkMemoryProperties memoryProperties = { };
         memoryProperties.flags = m_memFlags;
+        memoryProperties.tag.type   = DxvkMemoryTagType::SparseMeta;
+        memoryProperties.tag.usage  = m_info.usage;
+        memoryProperties.tag.format = m_info.format;
+        memoryProperties.tag.object = this;
 
         // Set size and alignment to match the metadata requirements
         auto& core = memoryRequirements.core.memoryRequirements;
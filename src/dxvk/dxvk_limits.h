@@ -18,6 +18,7 @@ namespace dxvk {
     MaxUniformBufferSize        = 65536,
     MaxVertexBindingStride      =  2048,
     MaxPushConstantSize         =   128,
+    MaxNumMetaDescriptors       =     4,
   };
   
 }
\ No newline at end of file
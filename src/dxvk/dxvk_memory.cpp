@@ -172,7 +172,14 @@ namespace dxvk {
       DxvkMemoryFlag::Small,
       DxvkMemoryFlag::GpuReadable,
       DxvkMemoryFlag::GpuWritable,
-      DxvkMemoryFlag::Transient);
+      DxvkMemoryFlag::Transient,
+      DxvkMemoryFlag::DeviceAddress);
+
+    // Memory allocated without device address support can
+    // never back buffers that need one, even when ignoring
+    // other constraints
+    if (hints.test(DxvkMemoryFlag::DeviceAddress) && !m_hints.test(DxvkMemoryFlag::DeviceAddress))
+      return false;
 
     if (hints.test(DxvkMemoryFlag::IgnoreConstraints))
       mask = DxvkMemoryFlags();
@@ -184,7 +191,8 @@ namespace dxvk {
   DxvkMemoryAllocator::DxvkMemoryAllocator(DxvkDevice* device)
   : m_device          (device),
     m_memProps        (device->adapter()->memoryProperties()),
-    m_maxChunkSize    (determineMaxChunkSize(device)) {
+    m_maxChunkSize    (determineMaxChunkSize(device)),
+    m_tracer          (m_memProps, m_maxChunkSize) {
     for (uint32_t i = 0; i < m_memProps.memoryHeapCount; i++) {
       m_memHeaps[i].properties = m_memProps.memoryHeaps[i];
       m_memHeaps[i].stats      = DxvkMemoryStats { 0, 0 };
@@ -213,6 +221,10 @@ namespace dxvk {
           DxvkMemoryFlags                   hints) {
     std::lock_guard<dxvk::mutex> lock(m_mutex);
 
+    // Device addresses are only needed for descriptor buffers
+    if (!m_device->canUseDescriptorBuffer())
+      hints.clr(DxvkMemoryFlag::DeviceAddress);
+
     // Keep small allocations together to avoid fragmenting
     // chunks for larger resources with lots of small gaps,
     // as well as resources with potentially weird lifetimes
@@ -224,7 +236,7 @@ namespace dxvk {
     // Ignore most hints for host-visible allocations since they
     // usually don't make much sense for those resources
     if (info.flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
-      hints = hints & DxvkMemoryFlag::Transient;
+      hints = hints & DxvkMemoryFlags(DxvkMemoryFlag::Transient, DxvkMemoryFlag::DeviceAddress);
 
     // If requested, try with a dedicated allocation first.
     if (info.dedicated.image || info.dedicated.buffer) {
@@ -368,6 +380,11 @@ namespace dxvk {
     if (memory) {
       type->heap->stats.memoryUsed += memory.m_length;
       m_device->notifyMemoryUse(type->heapId, memory.m_length);
+
+      if (unlikely(m_tracer.isEnabled())) {
+        m_tracer.record(DxvkMemoryTraceOp::Alloc, type->memTypeId,
+          memory.m_memory, memory.m_offset, memory.m_length, hints.raw(), info.tag);
+      }
     }
 
     return memory;
@@ -399,6 +416,9 @@ namespace dxvk {
     VkMemoryPriorityAllocateInfoEXT priorityInfo = { VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT };
     priorityInfo.priority       = priority;
 
+    VkMemoryAllocateFlagsInfo flagsInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO };
+    flagsInfo.flags             = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+
     VkMemoryAllocateInfo memoryInfo = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
     memoryInfo.allocationSize   = size;
     memoryInfo.memoryTypeIndex  = type->memTypeId;
@@ -415,6 +435,9 @@ namespace dxvk {
     if (useMemoryPriority)
       priorityInfo.pNext = std::exchange(memoryInfo.pNext, &priorityInfo);
 
+    if (hints.test(DxvkMemoryFlag::DeviceAddress))
+      flagsInfo.pNext = std::exchange(memoryInfo.pNext, &flagsInfo);
+
     if (vk->vkAllocateMemory(vk->device(), &memoryInfo, nullptr, &result.memHandle))
       return DxvkDeviceMemory();
     
@@ -430,6 +453,12 @@ namespace dxvk {
 
     type->heap->stats.memoryAllocated += size;
     m_device->notifyMemoryAlloc(type->heapId, size);
+
+    if (unlikely(m_tracer.isEnabled())) {
+      m_tracer.record(DxvkMemoryTraceOp::DeviceAlloc, type->memTypeId,
+        result.memHandle, 0, size, hints.raw(), info.tag);
+    }
+
     return result;
   }
 
@@ -439,6 +468,11 @@ namespace dxvk {
     std::lock_guard<dxvk::mutex> lock(m_mutex);
     memory.m_type->heap->stats.memoryUsed -= memory.m_length;
 
+    if (unlikely(m_tracer.isEnabled())) {
+      m_tracer.record(DxvkMemoryTraceOp::Free, memory.m_type->memTypeId,
+        memory.m_memory, memory.m_offset, memory.m_length, 0, DxvkMemoryTag());
+    }
+
     if (memory.m_chunk != nullptr) {
       this->freeChunkMemory(
         memory.m_type,
@@ -484,6 +518,11 @@ namespace dxvk {
     auto vk = m_device->vkd();
     vk->vkFreeMemory(vk->device(), memory.memHandle, nullptr);
 
+    if (unlikely(m_tracer.isEnabled())) {
+      m_tracer.record(DxvkMemoryTraceOp::DeviceFree, type->memTypeId,
+        memory.memHandle, 0, memory.memSize, 0, DxvkMemoryTag());
+    }
+
     type->heap->stats.memoryAllocated -= memory.memSize;
     m_device->notifyMemoryAlloc(type->heapId, memory.memSize);
   }
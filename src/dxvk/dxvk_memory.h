@@ -1,6 +1,7 @@
 #pragma once
 
 #include "dxvk_adapter.h"
+#include "dxvk_memory_trace.h"
 
 namespace dxvk {
   
@@ -188,6 +189,7 @@ namespace dxvk {
     GpuWritable       = 2,  ///< High-priority resource
     Transient         = 3,  ///< Resource is short-lived
     IgnoreConstraints = 4,  ///< Ignore most allocation flags
+    DeviceAddress     = 5,  ///< May back buffers with a device address
   };
 
   using DxvkMemoryFlags = Flags<DxvkMemoryFlag>;
@@ -290,6 +292,7 @@ namespace dxvk {
     VkImportMemoryWin32HandleInfoKHR sharedImportWin32;
     VkMemoryDedicatedAllocateInfo dedicated;
     VkMemoryPropertyFlags         flags;
+    DxvkMemoryTag                 tag;
   };
 
 
@@ -346,13 +349,15 @@ namespace dxvk {
 
     DxvkDevice*                                     m_device;
     VkPhysicalDeviceMemoryProperties                m_memProps;
+    VkDeviceSize                                    m_maxChunkSize;
+
+    // Must outlive the memory chunks
+    DxvkMemoryTracer                                m_tracer;
     
     dxvk::mutex                                     m_mutex;
     std::array<DxvkMemoryHeap, VK_MAX_MEMORY_HEAPS> m_memHeaps;
     std::array<DxvkMemoryType, VK_MAX_MEMORY_TYPES> m_memTypes;
 
-    VkDeviceSize                                    m_maxChunkSize;
-
     uint32_t m_sparseMemoryTypes = 0u;
 
     DxvkMemory tryAlloc(
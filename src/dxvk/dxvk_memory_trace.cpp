@@ -0,0 +1,100 @@
+#include <atomic>
+#include <cstring>
+
+#include "dxvk_memory_trace.h"
+
+namespace dxvk {
+
+  DxvkMemoryTracer::DxvkMemoryTracer(
+    const VkPhysicalDeviceMemoryProperties& memProps,
+          VkDeviceSize                      maxChunkSize)
+  : m_startTime(dxvk::high_resolution_clock::now()) {
+    std::string path = env::getEnvVar("DXVK_MEMORY_TRACE_PATH");
+
+    if (path.empty())
+      return;
+
+    str::path_string fileName = getFileName(path);
+    m_file = std::ofstream(fileName.c_str(), std::ios_base::binary | std::ios_base::trunc);
+
+    if (!m_file) {
+      Logger::err("DXVK: Failed to open memory trace file");
+      return;
+    }
+
+    DxvkMemoryTraceHeader header;
+    header.heapCount    = memProps.memoryHeapCount;
+    header.typeCount    = memProps.memoryTypeCount;
+    header.maxChunkSize = maxChunkSize;
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (uint32_t i = 0; i < memProps.memoryHeapCount; i++) {
+      DxvkMemoryTraceHeap heap = { };
+      heap.size  = memProps.memoryHeaps[i].size;
+      heap.flags = memProps.memoryHeaps[i].flags;
+
+      m_file.write(reinterpret_cast<const char*>(&heap), sizeof(heap));
+    }
+
+    for (uint32_t i = 0; i < memProps.memoryTypeCount; i++) {
+      DxvkMemoryTraceType type = { };
+      type.heapIndex = memProps.memoryTypes[i].heapIndex;
+      type.flags     = memProps.memoryTypes[i].propertyFlags;
+
+      m_file.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    }
+
+    Logger::info("DXVK: Memory allocation tracing enabled");
+    m_enabled = true;
+  }
+
+
+  DxvkMemoryTracer::~DxvkMemoryTracer() {
+
+  }
+
+
+  void DxvkMemoryTracer::record(
+          DxvkMemoryTraceOp     op,
+          uint32_t              memType,
+          VkDeviceMemory        memory,
+          VkDeviceSize          offset,
+          VkDeviceSize          size,
+          uint32_t              hints,
+    const DxvkMemoryTag&        tag) {
+    auto time = dxvk::high_resolution_clock::now();
+
+    DxvkMemoryTraceRecord record = { };
+    record.timestamp  = std::chrono::duration_cast<std::chrono::microseconds>(time - m_startTime).count();
+    record.offset     = offset;
+    record.size       = size;
+    record.object     = reinterpret_cast<uintptr_t>(tag.object);
+    record.usage      = tag.usage;
+    record.format     = uint32_t(tag.format);
+    record.op         = uint8_t(op);
+    record.tag        = uint8_t(tag.type);
+    record.memType    = uint8_t(memType);
+    record.hints      = uint8_t(hints);
+
+    // Handles are pointers on 64-bit platforms
+    std::memcpy(&record.memory, &memory, sizeof(memory));
+
+    m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+  }
+
+
+  str::path_string DxvkMemoryTracer::getFileName(
+    const std::string&                    path) {
+    static std::atomic<uint32_t> s_fileIndex = { 0u };
+
+    std::string fileName = path;
+
+    if (*fileName.rbegin() != '/')
+      fileName += '/';
+
+    fileName += str::format(env::getExeBaseName(), "_", s_fileIndex++, ".dxmt");
+    return str::topath(fileName.c_str());
+  }
+
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <fstream>
+
+#include "dxvk_include.h"
+
+#include "../util/util_time.h"
+
+namespace dxvk {
+
+  /**
+   * \brief Memory tag type
+   *
+   * Describes which kind of resource
+   * an allocation is used for.
+   */
+  enum class DxvkMemoryTagType : uint8_t {
+    Unknown     = 0,
+    Buffer      = 1,
+    Image       = 2,
+    Staging     = 3,
+    SparsePage  = 4,
+    SparseMeta  = 5,
+  };
+
+
+  /**
+   * \brief Memory tag
+   *
+   * Identifies the resource that owns an allocation.
+   * Only used for allocation tracing, so this has no
+   * effect on how memory gets allocated.
+   */
+  struct DxvkMemoryTag {
+    /// Resource type
+    DxvkMemoryTagType type   = DxvkMemoryTagType::Unknown;
+    /// Buffer or image usage flags
+    uint32_t          usage  = 0;
+    /// Image format, if any
+    VkFormat          format = VK_FORMAT_UNDEFINED;
+    /// Resource object that owns the memory
+    const void*       object = nullptr;
+  };
+
+
+  /**
+   * \brief Memory trace operation
+   */
+  enum class DxvkMemoryTraceOp : uint8_t {
+    DeviceAlloc = 0,  ///< Vulkan memory object allocated
+    DeviceFree  = 1,  ///< Vulkan memory object freed
+    Alloc       = 2,  ///< Memory sub-allocated
+    Free        = 3,  ///< Sub-allocation freed
+  };
+
+
+  /**
+   * \brief Memory trace file header
+   *
+   * Followed by one \ref DxvkMemoryTraceHeap entry
+   * per memory heap and one \ref DxvkMemoryTraceType
+   * per memory type, then a stream of records.
+   */
+  struct DxvkMemoryTraceHeader {
+    char      magic[4]  = { 'D', 'X', 'M', 'T' };
+    uint32_t  version   = 1;
+    uint32_t  heapCount = 0;
+    uint32_t  typeCount = 0;
+    uint64_t  maxChunkSize = 0;
+  };
+
+  struct DxvkMemoryTraceHeap {
+    uint64_t  size;
+    uint32_t  flags;
+    uint32_t  reserved;
+  };
+
+  struct DxvkMemoryTraceType {
+    uint32_t  heapIndex;
+    uint32_t  flags;
+  };
+
+
+  /**
+   * \brief Memory trace record
+   *
+   * For \c DeviceAlloc and \c DeviceFree records, the offset
+   * and tag fields are undefined. Dedicated allocations are
+   * recorded as a device allocation followed by a regular
+   * allocation at offset zero that covers the entire object.
+   */
+  struct DxvkMemoryTraceRecord {
+    uint64_t  timestamp;  ///< Microseconds since tracing started
+    uint64_t  memory;     ///< Vulkan memory object handle
+    uint64_t  offset;     ///< Allocation offset
+    uint64_t  size;       ///< Allocation size
+    uint64_t  object;     ///< Owning resource, see \ref DxvkMemoryTag
+    uint32_t  usage;      ///< Resource usage flags
+    uint32_t  format;     ///< Image format
+    uint8_t   op;         ///< Operation, see \ref DxvkMemoryTraceOp
+    uint8_t   tag;        ///< Resource type, see \ref DxvkMemoryTagType
+    uint8_t   memType;    ///< Vulkan memory type index
+    uint8_t   hints;      ///< Allocation hints
+    uint32_t  reserved;
+  };
+
+  static_assert(sizeof(DxvkMemoryTraceRecord) == 56);
+
+
+  /**
+   * \brief Memory allocation tracer
+   *
+   * Writes every device memory allocation and
+   * sub-allocation to a binary log file, which can
+   * be inspected with \c dxvk-memory-trace.py. Only
+   * enabled if \c DXVK_MEMORY_TRACE_PATH is set.
+   * Not thread-safe, must be externally synchronized.
+   */
+  class DxvkMemoryTracer {
+
+  public:
+
+    DxvkMemoryTracer(
+      const VkPhysicalDeviceMemoryProperties& memProps,
+            VkDeviceSize                      maxChunkSize);
+
+    ~DxvkMemoryTracer();
+
+    /**
+     * \brief Checks whether tracing is enabled
+     * \returns \c true if the trace file is open
+     */
+    bool isEnabled() const {
+      return m_enabled;
+    }
+
+    /**
+     * \brief Records an operation
+     *
+     * \param [in] op Operation
+     * \param [in] memType Memory type index
+     * \param [in] memory Vulkan memory object
+     * \param [in] offset Allocation offset
+     * \param [in] size Allocation size
+     * \param [in] hints Allocation hints
+     * \param [in] tag Resource tag
+     */
+    void record(
+            DxvkMemoryTraceOp     op,
+            uint32_t              memType,
+            VkDeviceMemory        memory,
+            VkDeviceSize          offset,
+            VkDeviceSize          size,
+            uint32_t              hints,
+      const DxvkMemoryTag&        tag);
+
+  private:
+
+    bool                                    m_enabled = false;
+    std::ofstream                           m_file;
+
+    dxvk::high_resolution_clock::time_point m_startTime;
+
+    static str::path_string getFileName(
+      const std::string&                    path);
+
+  };
+
+}
@@ -118,6 +118,7 @@ namespace dxvk {
 
   DxvkMetaBlitObjects::DxvkMetaBlitObjects(const DxvkDevice* device)
   : m_vkd         (device->vkd()),
+    m_dsetLayoutFlags(device->getMetaDescriptorSetLayoutFlags()),
     m_samplerCopy (createSampler(VK_FILTER_NEAREST)),
     m_samplerBlit (createSampler(VK_FILTER_LINEAR)),
     m_shaderFrag1D(createShaderModule(dxvk_blit_frag_1d)),
@@ -224,6 +225,7 @@ namespace dxvk {
       VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_FRAGMENT_BIT };
     
     VkDescriptorSetLayoutCreateInfo info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    info.flags                  = m_dsetLayoutFlags;
     info.bindingCount           = 1;
     info.pBindings              = &binding;
     
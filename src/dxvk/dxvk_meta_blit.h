@@ -171,6 +171,8 @@ namespace dxvk {
   private:
     
     Rc<vk::DeviceFn>  m_vkd;
+
+    VkDescriptorSetLayoutCreateFlags m_dsetLayoutFlags;
     
     VkSampler m_samplerCopy;
     VkSampler m_samplerBlit;
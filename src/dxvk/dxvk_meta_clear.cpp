@@ -17,7 +17,8 @@
 namespace dxvk {
   
   DxvkMetaClearObjects::DxvkMetaClearObjects(const DxvkDevice* device)
-  : m_vkd(device->vkd()) {
+  : m_vkd(device->vkd()),
+    m_dsetLayoutFlags(device->getMetaDescriptorSetLayoutFlags()) {
     // Create descriptor set layouts
     m_clearBufDsetLayout = createDescriptorSetLayout(VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER);
     m_clearImgDsetLayout = createDescriptorSetLayout(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
@@ -119,6 +120,7 @@ namespace dxvk {
     VkDescriptorSetLayoutBinding bindInfo = { 0, descriptorType, 1, VK_SHADER_STAGE_COMPUTE_BIT };
     
     VkDescriptorSetLayoutCreateInfo dsetInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    dsetInfo.flags              = m_dsetLayoutFlags;
     dsetInfo.bindingCount       = 1;
     dsetInfo.pBindings          = &bindInfo;
     
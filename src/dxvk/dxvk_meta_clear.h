@@ -86,6 +86,8 @@ namespace dxvk {
     };
     
     Rc<vk::DeviceFn> m_vkd;
+
+    VkDescriptorSetLayoutCreateFlags m_dsetLayoutFlags;
     
     VkDescriptorSetLayout m_clearBufDsetLayout = VK_NULL_HANDLE;
     VkDescriptorSetLayout m_clearImgDsetLayout = VK_NULL_HANDLE;
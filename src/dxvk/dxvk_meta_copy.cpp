@@ -78,6 +78,7 @@ namespace dxvk {
   
   DxvkMetaCopyObjects::DxvkMetaCopyObjects(const DxvkDevice* device)
   : m_vkd         (device->vkd()),
+    m_dsetLayoutFlags(device->getMetaDescriptorSetLayoutFlags()),
     m_color {
       createShaderModule(dxvk_copy_color_1d),
       createShaderModule(dxvk_copy_color_2d),
@@ -199,6 +200,7 @@ namespace dxvk {
     }};
 
     VkDescriptorSetLayoutCreateInfo setLayoutInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    setLayoutInfo.flags = m_dsetLayoutFlags;
     setLayoutInfo.bindingCount = bindings.size();
     setLayoutInfo.pBindings = bindings.data();
 
@@ -253,6 +255,7 @@ namespace dxvk {
     }};
     
     VkDescriptorSetLayoutCreateInfo info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    info.flags = m_dsetLayoutFlags;
     info.bindingCount = bindings.size();
     info.pBindings = bindings.data();
 
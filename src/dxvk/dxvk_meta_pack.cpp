@@ -12,6 +12,7 @@ namespace dxvk {
 
   DxvkMetaPackObjects::DxvkMetaPackObjects(const DxvkDevice* device)
   : m_vkd             (device->vkd()),
+    m_dsetLayoutFlags (device->getMetaDescriptorSetLayoutFlags()),
     m_dsetLayoutPack  (createPackDescriptorSetLayout()),
     m_dsetLayoutUnpack(createUnpackDescriptorSetLayout()),
     m_pipeLayoutPack  (createPipelineLayout(m_dsetLayoutPack, sizeof(DxvkMetaPackArgs))),
@@ -96,6 +97,7 @@ namespace dxvk {
     }};
 
     VkDescriptorSetLayoutCreateInfo dsetInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    dsetInfo.flags        = m_dsetLayoutFlags;
     dsetInfo.bindingCount = bindings.size();
     dsetInfo.pBindings    = bindings.data();
 
@@ -114,6 +116,7 @@ namespace dxvk {
     }};
 
     VkDescriptorSetLayoutCreateInfo dsetInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    dsetInfo.flags        = m_dsetLayoutFlags;
     dsetInfo.bindingCount = bindings.size();
     dsetInfo.pBindings    = bindings.data();
 
@@ -152,7 +155,9 @@ namespace dxvk {
     VkDescriptorUpdateTemplateCreateInfo templateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO };
     templateInfo.descriptorUpdateEntryCount = bindings.size();
     templateInfo.pDescriptorUpdateEntries   = bindings.data();
-    templateInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    templateInfo.templateType               = (m_dsetLayoutFlags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+      ? VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR
+      : VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
     templateInfo.descriptorSetLayout        = m_dsetLayoutPack;
     templateInfo.pipelineBindPoint          = VK_PIPELINE_BIND_POINT_COMPUTE;
     templateInfo.pipelineLayout             = m_pipeLayoutPack;
@@ -175,7 +180,9 @@ namespace dxvk {
     VkDescriptorUpdateTemplateCreateInfo templateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO };
     templateInfo.descriptorUpdateEntryCount = bindings.size();
     templateInfo.pDescriptorUpdateEntries   = bindings.data();
-    templateInfo.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    templateInfo.templateType               = (m_dsetLayoutFlags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR)
+      ? VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR
+      : VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
     templateInfo.descriptorSetLayout        = m_dsetLayoutUnpack;
     templateInfo.pipelineBindPoint          = VK_PIPELINE_BIND_POINT_COMPUTE;
     templateInfo.pipelineLayout             = m_pipeLayoutUnpack;
@@ -92,6 +92,8 @@ namespace dxvk {
 
     Rc<vk::DeviceFn>      m_vkd;
 
+    VkDescriptorSetLayoutCreateFlags m_dsetLayoutFlags;
+
     VkDescriptorSetLayout m_dsetLayoutPack;
     VkDescriptorSetLayout m_dsetLayoutUnpack;
 
@@ -54,6 +54,7 @@ namespace dxvk {
 
   DxvkMetaResolveObjects::DxvkMetaResolveObjects(const DxvkDevice* device)
   : m_vkd         (device->vkd()),
+    m_dsetLayoutFlags(device->getMetaDescriptorSetLayoutFlags()),
     m_shaderFragF (device->features().amdShaderFragmentMask
       ? createShaderModule(dxvk_resolve_frag_f_amd)
       : createShaderModule(dxvk_resolve_frag_f)),
@@ -143,6 +144,7 @@ namespace dxvk {
     }};
     
     VkDescriptorSetLayoutCreateInfo info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    info.flags = m_dsetLayoutFlags;
     info.bindingCount = bindings.size();
     info.pBindings = bindings.data();
 
@@ -112,6 +112,8 @@ namespace dxvk {
 
     Rc<vk::DeviceFn> m_vkd;
 
+    VkDescriptorSetLayoutCreateFlags m_dsetLayoutFlags;
+
     VkShaderModule m_shaderVert  = VK_NULL_HANDLE;
     VkShaderModule m_shaderGeom  = VK_NULL_HANDLE;
     VkShaderModule m_shaderFragF = VK_NULL_HANDLE;
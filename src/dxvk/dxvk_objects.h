@@ -1,5 +1,6 @@
 #pragma once
 
+#include "dxvk_buffer_arena.h"
 #include "dxvk_gpu_event.h"
 #include "dxvk_gpu_query.h"
 #include "dxvk_memory.h"
@@ -24,6 +25,7 @@ namespace dxvk {
     DxvkObjects(DxvkDevice* device)
     : m_device          (device),
       m_memoryManager   (device),
+      m_bufferArena     (device, m_memoryManager),
       m_pipelineManager (device),
       m_eventPool       (device),
       m_queryPool       (device),
@@ -35,6 +37,10 @@ namespace dxvk {
       return m_memoryManager;
     }
 
+    DxvkBufferArena& bufferArena() {
+      return m_bufferArena;
+    }
+
     DxvkPipelineManager& pipelineManager() {
       return m_pipelineManager;
     }
@@ -76,6 +82,7 @@ namespace dxvk {
     DxvkDevice*                   m_device;
 
     DxvkMemoryAllocator           m_memoryManager;
+    DxvkBufferArena               m_bufferArena;
     DxvkPipelineManager           m_pipelineManager;
 
     DxvkGpuEventPool              m_eventPool;
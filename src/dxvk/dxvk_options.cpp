@@ -9,6 +9,9 @@ namespace dxvk {
     enableGraphicsPipelineLibrary = config.getOption<Tristate>("dxvk.enableGraphicsPipelineLibrary", Tristate::Auto);
     trackPipelineLifetime = config.getOption<Tristate>("dxvk.trackPipelineLifetime",  Tristate::Auto);
     useRawSsbo            = config.getOption<Tristate>("dxvk.useRawSsbo",             Tristate::Auto);
+    enableSplitBarriers   = config.getOption<bool>    ("dxvk.enableSplitBarriers",    false);
+    enableDescriptorBuffer = config.getOption<bool>   ("dxvk.enableDescriptorBuffer", false);
+    enableAsyncTransfer   = config.getOption<bool>    ("dxvk.enableAsyncTransfer",    false);
     maxChunkSize          = config.getOption<int32_t> ("dxvk.maxChunkSize",           0);
     hud                   = config.getOption<std::string>("dxvk.hud", "");
     tearFree              = config.getOption<Tristate>("dxvk.tearFree",               Tristate::Auto);
@@ -27,6 +27,18 @@ namespace dxvk {
     /// Shader-related options
     Tristate useRawSsbo;
 
+    /// Use events to synchronize uploads with
+    /// prior rendering work where possible
+    bool enableSplitBarriers;
+
+    /// Write shader descriptors to descriptor
+    /// buffers instead of descriptor sets
+    bool enableDescriptorBuffer;
+
+    /// Submit resource initialization uploads to the
+    /// transfer queue ahead of dependent rendering work
+    bool enableAsyncTransfer;
+
     /// Maximum memory chunk size in MiB
     int32_t maxChunkSize;
 
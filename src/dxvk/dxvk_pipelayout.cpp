@@ -180,10 +180,22 @@ namespace dxvk {
     layoutInfo.bindingCount = bindingInfos.size();
     layoutInfo.pBindings = bindingInfos.data();
 
+    if (m_device->canUseDescriptorBuffer())
+      layoutInfo.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
     if (vk->vkCreateDescriptorSetLayout(vk->device(), &layoutInfo, nullptr, &m_layout) != VK_SUCCESS)
       throw DxvkError("DxvkBindingSetLayoutKey: Failed to create descriptor set layout");
 
-    if (layoutInfo.bindingCount) {
+    if (layoutInfo.flags & VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT) {
+      // Descriptor buffers are written directly, so there is no need
+      // for an update template, but we need to know the memory layout
+      vk->vkGetDescriptorSetLayoutSizeEXT(vk->device(), m_layout, &m_descriptorSize);
+
+      m_descriptorOffsets.resize(layoutInfo.bindingCount);
+
+      for (uint32_t i = 0; i < layoutInfo.bindingCount; i++)
+        vk->vkGetDescriptorSetLayoutBindingOffsetEXT(vk->device(), m_layout, i, &m_descriptorOffsets[i]);
+    } else if (layoutInfo.bindingCount) {
       VkDescriptorUpdateTemplateCreateInfo templateInfo = { VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO };
       templateInfo.descriptorUpdateEntryCount = templateInfos.size();
       templateInfo.pDescriptorUpdateEntries = templateInfos.data();
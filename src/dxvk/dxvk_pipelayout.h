@@ -233,12 +233,36 @@ namespace dxvk {
       return m_template;
     }
 
+    /**
+     * \brief Queries descriptor buffer memory size
+     *
+     * Only defined if descriptor buffers are used.
+     * \returns Number of bytes required for the set
+     */
+    VkDeviceSize getDescriptorSize() const {
+      return m_descriptorSize;
+    }
+
+    /**
+     * \brief Queries descriptor offset for a binding
+     *
+     * Only defined if descriptor buffers are used.
+     * \param [in] binding Binding index within the set
+     * \returns Offset of the descriptor within the set
+     */
+    VkDeviceSize getDescriptorOffset(uint32_t binding) const {
+      return m_descriptorOffsets[binding];
+    }
+
   private:
 
     DxvkDevice*                   m_device;
     VkDescriptorSetLayout         m_layout    = VK_NULL_HANDLE;
     VkDescriptorUpdateTemplate    m_template  = VK_NULL_HANDLE;
 
+    VkDeviceSize                  m_descriptorSize = 0;
+    std::vector<VkDeviceSize>     m_descriptorOffsets;
+
   };
 
 
@@ -476,6 +500,18 @@ namespace dxvk {
       return m_bindingObjects[set]->getSetUpdateTemplate();
     }
 
+    /**
+     * \brief Retrieves descriptor set layout object for a given set
+     *
+     * Provides the descriptor buffer memory
+     * layout if descriptor buffers are used.
+     * \param [in] set Descriptor set index
+     * \returns Descriptor set layout object
+     */
+    const DxvkBindingSetLayout* getSetLayoutObjects(uint32_t set) const {
+      return m_bindingObjects[set];
+    }
+
     /**
      * \brief Retrieves pipeline layout
      *
@@ -5,6 +5,9 @@ namespace dxvk {
   
   DxvkSubmissionQueue::DxvkSubmissionQueue(DxvkDevice* device, const DxvkQueueCallback& callback)
   : m_device(device), m_callback(callback),
+    m_transferFence(device->canUseAsyncTransfer()
+      ? device->createFence(DxvkFenceCreateInfo())
+      : nullptr),
     m_submitThread([this] () { submitCmdLists(); }),
     m_finishThread([this] () { finishCmdLists(); }) {
 
@@ -30,7 +33,8 @@ namespace dxvk {
     std::unique_lock<dxvk::mutex> lock(m_mutex);
 
     m_finishCond.wait(lock, [this] {
-      return m_submitQueue.size() + m_finishQueue.size() <= MaxNumQueuedCommandBuffers;
+      return m_submitQueue.size() + m_deferQueue.size()
+           + m_finishQueue.size() <= MaxNumQueuedCommandBuffers;
     });
 
     DxvkSubmitEntry entry = { };
@@ -68,7 +72,7 @@ namespace dxvk {
     std::unique_lock<dxvk::mutex> lock(m_mutex);
 
     m_submitCond.wait(lock, [this] {
-      return m_submitQueue.empty();
+      return m_submitQueue.empty() && m_deferQueue.empty();
     });
   }
 
@@ -77,7 +81,7 @@ namespace dxvk {
     std::unique_lock<dxvk::mutex> lock(m_mutex);
 
     m_submitCond.wait(lock, [this] {
-      return m_submitQueue.empty();
+      return m_submitQueue.empty() && m_deferQueue.empty();
     });
 
     m_finishCond.wait(lock, [this] {
@@ -102,60 +106,159 @@ namespace dxvk {
   }
 
 
+  VkResult DxvkSubmissionQueue::submitEntry(
+          DxvkSubmitEntry&    entry,
+          bool                asyncTransfer) {
+    // Don't submit anything after device loss
+    // so that drivers get a chance to recover
+    if (m_lastError == VK_ERROR_DEVICE_LOST)
+      return VK_ERROR_DEVICE_LOST;
+
+    std::lock_guard<dxvk::mutex> lock(m_mutexQueue);
+
+    if (m_callback)
+      m_callback(true);
+
+    VkResult result = VK_SUCCESS;
+
+    if (asyncTransfer)
+      result = entry.submit.cmdList->submitAsyncTransfer(m_transferFence->handle(), ++m_transferValue);
+    else if (entry.submit.cmdList != nullptr)
+      result = entry.submit.cmdList->submit();
+    else if (entry.present.presenter != nullptr)
+      result = entry.present.presenter->presentImage(entry.present.presentMode, entry.present.frameId);
+
+    if (m_callback)
+      m_callback(false);
+
+    return result;
+  }
+
+
+  void DxvkSubmissionQueue::forwardEntry(
+          DxvkSubmitEntry&&   entry) {
+    if (entry.status)
+      entry.status->result = entry.result;
+
+    // On success, pass it on to the queue thread
+    bool doForward = (entry.result == VK_SUCCESS) ||
+      (entry.present.presenter != nullptr && entry.result != VK_ERROR_DEVICE_LOST);
+
+    if (doForward) {
+      m_finishQueue.push(std::move(entry));
+    } else {
+      Logger::err(str::format("DxvkSubmissionQueue: Command submission failed: ", entry.result));
+      m_lastError = entry.result;
+
+      if (m_lastError != VK_ERROR_DEVICE_LOST)
+        m_device->waitForIdle();
+    }
+  }
+
+
+  void DxvkSubmissionQueue::submitDeferredCmdLists(
+          std::unique_lock<dxvk::mutex>& lock,
+          uint64_t            dependency) {
+    // Find the most recent deferred command list that either has
+    // a dependent submission, or whose transfers have completed.
+    // Deferred command lists must be submitted in order.
+    uint64_t transferValue = m_transferFence->getValue();
+    size_t count = 0;
+
+    for (size_t i = 0; i < m_deferQueue.size(); i++) {
+      const auto& cmdList = m_deferQueue[i].submit.cmdList;
+
+      if (cmdList->getAsyncTransferId() <= dependency
+       || cmdList->getAsyncTransferValue() <= transferValue)
+        count = i + 1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      DxvkSubmitEntry entry = std::move(m_deferQueue.front());
+      lock.unlock();
+
+      entry.result = submitEntry(entry, false);
+
+      lock.lock();
+      forwardEntry(std::move(entry));
+
+      m_deferQueue.pop_front();
+    }
+
+    if (count)
+      m_submitCond.notify_all();
+  }
+
+
   void DxvkSubmissionQueue::submitCmdLists() {
     env::setThreadName("dxvk-submit");
 
     std::unique_lock<dxvk::mutex> lock(m_mutex);
 
     while (!m_stopped.load()) {
+      // Deferred command lists can be submitted once the transfers
+      // of the oldest one have completed, which gets signaled by
+      // the transfer fence's wait thread.
       m_appendCond.wait(lock, [this] {
-        return m_stopped.load() || !m_submitQueue.empty();
+        return m_stopped.load() || !m_submitQueue.empty()
+          || (!m_deferQueue.empty() && m_deferQueue.front().submit.cmdList
+            ->getAsyncTransferValue() <= m_transferSignaled);
       });
-      
+
       if (m_stopped.load())
         return;
-      
+
+      bool asyncTransfer = false;
+
+      if (!m_submitQueue.empty()) {
+        const auto& cmdList = m_submitQueue.front().submit.cmdList;
+        asyncTransfer = m_transferFence != nullptr
+          && cmdList != nullptr && cmdList->isAsyncTransfer();
+      }
+
+      if (!m_deferQueue.empty()) {
+        uint64_t dependency = 0;
+
+        if (!m_submitQueue.empty() && !asyncTransfer) {
+          const auto& cmdList = m_submitQueue.front().submit.cmdList;
+
+          if (cmdList != nullptr)
+            dependency = cmdList->getAsyncTransferDependency();
+        }
+
+        submitDeferredCmdLists(lock, dependency);
+      }
+
+      if (m_submitQueue.empty())
+        continue;
+
       DxvkSubmitEntry entry = std::move(m_submitQueue.front());
       lock.unlock();
 
       // Submit command buffer to device
-      if (m_lastError != VK_ERROR_DEVICE_LOST) {
-        std::lock_guard<dxvk::mutex> lock(m_mutexQueue);
-
-        if (m_callback)
-          m_callback(true);
-
-        if (entry.submit.cmdList != nullptr)
-          entry.result = entry.submit.cmdList->submit();
-        else if (entry.present.presenter != nullptr)
-          entry.result = entry.present.presenter->presentImage(entry.present.presentMode, entry.present.frameId);
-
-        if (m_callback)
-          m_callback(false);
-      } else {
-        // Don't submit anything after device loss
-        // so that drivers get a chance to recover
-        entry.result = VK_ERROR_DEVICE_LOST;
+      entry.result = submitEntry(entry, asyncTransfer);
+
+      // Wake up the submission thread once the transfers complete. This
+      // must be done without holding the lock since the fence may invoke
+      // the callback immediately.
+      if (asyncTransfer && entry.result == VK_SUCCESS) {
+        uint64_t transferValue = entry.submit.cmdList->getAsyncTransferValue();
+
+        m_transferFence->enqueueWait(transferValue, [this, transferValue] {
+          std::unique_lock<dxvk::mutex> lock(m_mutex);
+          m_transferSignaled = std::max(m_transferSignaled, transferValue);
+          m_appendCond.notify_all();
+        });
       }
 
-      if (entry.status)
-        entry.status->result = entry.result;
-      
-      // On success, pass it on to the queue thread
       lock = std::unique_lock<dxvk::mutex>(m_mutex);
 
-      bool doForward = (entry.result == VK_SUCCESS) ||
-        (entry.present.presenter != nullptr && entry.result != VK_ERROR_DEVICE_LOST);
-
-      if (doForward) {
-        m_finishQueue.push(std::move(entry));
-      } else {
-        Logger::err(str::format("DxvkSubmissionQueue: Command submission failed: ", entry.result));
-        m_lastError = entry.result;
-
-        if (m_lastError != VK_ERROR_DEVICE_LOST)
-          m_device->waitForIdle();
-      }
+      // Only transfer commands have been submitted so far,
+      // hold back the rest until it is actually needed
+      if (asyncTransfer && entry.result == VK_SUCCESS)
+        m_deferQueue.push_back(std::move(entry));
+      else
+        forwardEntry(std::move(entry));
 
       m_submitQueue.pop();
       m_submitCond.notify_all();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
 
@@ -61,6 +62,13 @@ namespace dxvk {
 
   /**
    * \brief Submission queue
+   *
+   * If async transfers are enabled, transfer commands of
+   * resource initialization command lists are submitted
+   * immediately, while the remaining graphics work waits
+   * on a timeline semaphore and only gets submitted once
+   * it is needed by subsequent submissions, or once the
+   * transfers have completed on the GPU.
    */
   class DxvkSubmissionQueue {
 
@@ -193,10 +201,26 @@ namespace dxvk {
 
     std::queue<DxvkSubmitEntry> m_submitQueue;
     std::queue<DxvkSubmitEntry> m_finishQueue;
+    std::deque<DxvkSubmitEntry> m_deferQueue;
+
+    Rc<DxvkFence>               m_transferFence;
+    uint64_t                    m_transferValue = 0;
+    uint64_t                    m_transferSignaled = 0;
 
     dxvk::thread                m_submitThread;
     dxvk::thread                m_finishThread;
 
+    VkResult submitEntry(
+            DxvkSubmitEntry&    entry,
+            bool                asyncTransfer);
+
+    void forwardEntry(
+            DxvkSubmitEntry&&   entry);
+
+    void submitDeferredCmdLists(
+            std::unique_lock<dxvk::mutex>& lock,
+            uint64_t            dependency);
+
     void submitCmdLists();
 
     void finishCmdLists();
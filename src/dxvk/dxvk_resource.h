@@ -102,12 +102,111 @@ namespace dxvk {
         mask |= RdAccessMask;
       return bool(m_useCount.load() & mask);
     }
+
+    /**
+     * \brief Marks resource as used by a submission
+     *
+     * Used to detect whether a command can safely be moved
+     * to the start of the current submission, and to avoid
+     * tracking the same resource multiple times within one
+     * submission. Only the highest submission ID for each
+     * access type is stored, so that tracking the resource
+     * from another context cannot hide prior use.
+     * \param [in] submission Submission ID
+     * \param [in] access Access type
+     */
+    void trackSubmission(uint64_t submission, DxvkAccess access) {
+      if (access == DxvkAccess::None) {
+        updateSubmission(m_noSubmission, submission);
+      } else {
+        updateSubmission(m_rdSubmission, submission);
+
+        if (access == DxvkAccess::Write)
+          updateSubmission(m_wrSubmission, submission);
+      }
+    }
+
+    /**
+     * \brief Checks whether resource may be used by a submission
+     *
+     * This is conservative and also returns \c true if the
+     * resource is used by any submission that started later.
+     * Checking for reads will also return \c true if the
+     * resource is being written to.
+     * \param [in] submission Submission ID
+     * \param [in] access Access type to check for
+     * \returns \c true if the submission may use the resource
+     */
+    bool isUsedBySubmission(uint64_t submission, DxvkAccess access = DxvkAccess::Read) const {
+      if (access == DxvkAccess::Write)
+        return m_wrSubmission.load(std::memory_order_relaxed) >= submission;
+
+      return m_rdSubmission.load(std::memory_order_relaxed) >= submission
+          || m_noSubmission.load(std::memory_order_relaxed) >= submission;
+    }
+
+    /**
+     * \brief Checks whether resource is tracked by a submission
+     *
+     * Unlike \ref isUsedBySubmission, this only returns \c true
+     * if the submission already holds a reference that marks
+     * the resource as in use for the given access type.
+     * \param [in] submission Submission ID
+     * \param [in] access Access type to check for
+     * \returns \c true if tracking the resource again is redundant
+     */
+    bool isTrackedBySubmission(uint64_t submission, DxvkAccess access) const {
+      switch (access) {
+        case DxvkAccess::Write:
+          return m_wrSubmission.load(std::memory_order_relaxed) == submission;
+
+        case DxvkAccess::Read:
+          return m_rdSubmission.load(std::memory_order_relaxed) == submission;
+
+        default:
+          return m_rdSubmission.load(std::memory_order_relaxed) == submission
+              || m_noSubmission.load(std::memory_order_relaxed) == submission;
+      }
+    }
+
+    /**
+     * \brief Marks resource as used by an async transfer
+     *
+     * Graphics work of command lists that perform async
+     * transfers may be deferred, so any later submission
+     * that uses the resource must be ordered after it.
+     * \param [in] id Async transfer ID of the command list
+     */
+    void trackAsyncTransfer(uint64_t id) {
+      m_asyncTransfer.store(id, std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Queries most recent async transfer ID
+     * \returns Async transfer ID, or 0 if none
+     */
+    uint64_t getAsyncTransfer() const {
+      return m_asyncTransfer.load(std::memory_order_relaxed);
+    }
     
   private:
     
     std::atomic<uint64_t> m_useCount;
     uint64_t              m_cookie;
 
+    std::atomic<uint64_t> m_rdSubmission = { 0ull };
+    std::atomic<uint64_t> m_wrSubmission = { 0ull };
+    std::atomic<uint64_t> m_noSubmission = { 0ull };
+    std::atomic<uint64_t> m_asyncTransfer = { 0ull };
+
+    static void updateSubmission(std::atomic<uint64_t>& id, uint64_t submission) {
+      uint64_t current = id.load(std::memory_order_relaxed);
+
+      while (current < submission && !id.compare_exchange_weak(
+          current, submission, std::memory_order_relaxed))
+        continue;
+    }
+
     static constexpr uint64_t getIncrement(DxvkAccess access) {
       uint64_t increment = RefcountInc;
 
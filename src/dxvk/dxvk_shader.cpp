@@ -1240,7 +1240,7 @@ namespace dxvk {
     libInfo.flags             = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
 
     VkGraphicsPipelineCreateInfo info = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, &libInfo };
-    info.flags                = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | flags;
+    info.flags                = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | flags | m_device->getShaderPipelineCreateFlags();
     info.stageCount           = stageInfo.getStageCount();
     info.pStages              = stageInfo.getStageInfos();
     info.pTessellationState   = m_shaders.tcs ? &tsInfo : nullptr;
@@ -1328,7 +1328,7 @@ namespace dxvk {
     libInfo.flags             = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
 
     VkGraphicsPipelineCreateInfo info = { VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO, &libInfo };
-    info.flags                = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | flags;
+    info.flags                = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | flags | m_device->getShaderPipelineCreateFlags();
     info.stageCount           = stageInfo.getStageCount();
     info.pStages              = stageInfo.getStageInfos();
     info.pDepthStencilState   = &dsInfo;
@@ -1356,7 +1356,7 @@ namespace dxvk {
 
     // Compile the compute pipeline as normal
     VkComputePipelineCreateInfo info = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
-    info.flags        = flags;
+    info.flags        = flags | m_device->getShaderPipelineCreateFlags();
     info.stage        = *stageInfo.getStageInfos();
     info.layout       = m_layout->getPipelineLayout(false);
     info.basePipelineIndex = -1;
@@ -152,9 +152,12 @@ namespace dxvk {
 
     DxvkMemoryProperties memoryProperties = { };
     memoryProperties.flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    memoryProperties.tag.type   = DxvkMemoryTagType::SparsePage;
+    memoryProperties.tag.object = this;
 
-    DxvkMemory memory = m_memory->alloc(memoryRequirements,
-      memoryProperties, DxvkMemoryFlag::GpuReadable);
+    // Pages may get bound to buffers that need a device address
+    DxvkMemory memory = m_memory->alloc(memoryRequirements, memoryProperties,
+      DxvkMemoryFlags(DxvkMemoryFlag::GpuReadable, DxvkMemoryFlag::DeviceAddress));
 
     return new DxvkSparsePage(std::move(memory));
   }
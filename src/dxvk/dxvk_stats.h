@@ -15,6 +15,10 @@ namespace dxvk {
     CmdDispatchCalls,         ///< Number of compute calls
     CmdRenderPassCount,       ///< Number of render passes
     CmdBarrierCount,          ///< Number of pipeline barriers
+    CmdSplitBarrierCount,     ///< Number of barriers replaced by events
+    CmdHoistedTransferCount,  ///< Number of transfers moved out of render passes
+    CmdConversionCount,       ///< Number of format conversions
+    CmdConversionBatchCount,  ///< Number of format conversion batches
     PipeCountGraphics,        ///< Number of graphics pipelines
     PipeCountLibrary,         ///< Number of graphics shader libraries
     PipeCountCompute,         ///< Number of compute pipelines
@@ -30,6 +34,9 @@ namespace dxvk {
     CsChunkCount,             ///< Submitted CS chunks
     DescriptorPoolCount,      ///< Descriptor pool count
     DescriptorSetCount,       ///< Descriptor sets allocated
+    DescriptorSetLookups,     ///< Descriptor set cache lookups
+    DescriptorSetReuses,      ///< Descriptor sets reused from the cache
+    BufferRenameMemory,       ///< Memory used for buffer renaming
     NumCounters,              ///< Number of counters available
   };
   
@@ -77,6 +84,16 @@ namespace dxvk {
       m_counters[uint32_t(ctr)] += val;
     }
     
+    /**
+     * \brief Decrements a counter value
+     * 
+     * \param [in] ctr Counter to decrement
+     * \param [in] val Number to subtract from counter value
+     */
+    void subCtr(DxvkStatCounter ctr, uint64_t val) {
+      m_counters[uint32_t(ctr)] -= val;
+    }
+    
     /**
      * \brief Resets a counter
      * \param [in] ctr The counter
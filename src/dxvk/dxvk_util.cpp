@@ -19,13 +19,79 @@ namespace dxvk::util {
   }
   
   
+  // Image uploads larger than this are unlikely to fit into the CPU
+  // cache, and staging memory is usually write-combined and never
+  // read back, so use streaming stores to avoid evicting useful data.
+  // Callers opt into this, since readbacks into application memory
+  // are likely to be accessed by the CPU right away.
+  constexpr VkDeviceSize NonTemporalCopyThreshold = VkDeviceSize(256) << 10;
+
+
+  static void copyImageData(
+          char*             dstData,
+    const char*             srcData,
+          size_t            size,
+          bool              nonTemporal) {
+#ifdef DXVK_ARCH_X86
+    if (nonTemporal && size >= 4 * sizeof(__m128i)) {
+      // Streaming stores require an aligned destination
+      size_t head = (-reinterpret_cast<uintptr_t>(dstData)) & (sizeof(__m128i) - 1);
+
+      if (head) {
+        std::memcpy(dstData, srcData, head);
+        dstData += head;
+        srcData += head;
+        size -= head;
+      }
+
+      auto dstVec = reinterpret_cast<__m128i*>(dstData);
+      auto srcVec = reinterpret_cast<const __m128i*>(srcData);
+
+      size_t count = size / (4 * sizeof(__m128i));
+
+      for (size_t i = 0; i < count; i++) {
+        __m128i a = _mm_loadu_si128(srcVec + 0);
+        __m128i b = _mm_loadu_si128(srcVec + 1);
+        __m128i c = _mm_loadu_si128(srcVec + 2);
+        __m128i d = _mm_loadu_si128(srcVec + 3);
+
+        _mm_stream_si128(dstVec + 0, a);
+        _mm_stream_si128(dstVec + 1, b);
+        _mm_stream_si128(dstVec + 2, c);
+        _mm_stream_si128(dstVec + 3, d);
+
+        dstVec += 4;
+        srcVec += 4;
+      }
+
+      size_t copied = count * 4 * sizeof(__m128i);
+      dstData += copied;
+      srcData += copied;
+      size -= copied;
+    }
+#endif
+
+    if (size)
+      std::memcpy(dstData, srcData, size);
+  }
+
+
+  static void finishImageData(bool nonTemporal) {
+#ifdef DXVK_ARCH_X86
+    if (nonTemporal)
+      _mm_sfence();
+#endif
+  }
+
+
   void packImageData(
           void*             dstBytes,
     const void*             srcBytes,
           VkExtent3D        blockCount,
           VkDeviceSize      blockSize,
           VkDeviceSize      pitchPerRow,
-          VkDeviceSize      pitchPerLayer) {
+          VkDeviceSize      pitchPerLayer,
+          bool              nonTemporal) {
     auto dstData = reinterpret_cast<      char*>(dstBytes);
     auto srcData = reinterpret_cast<const char*>(srcBytes);
     
@@ -36,21 +102,25 @@ namespace dxvk::util {
     const bool directCopy = ((bytesPerRow   == pitchPerRow  ) || (blockCount.height == 1))
                          && ((bytesPerLayer == pitchPerLayer) || (blockCount.depth  == 1));
     
+    nonTemporal &= bytesTotal >= NonTemporalCopyThreshold;
+
     if (directCopy) {
-      std::memcpy(dstData, srcData, bytesTotal);
+      copyImageData(dstData, srcData, bytesTotal, nonTemporal);
     } else {
       for (uint32_t i = 0; i < blockCount.depth; i++) {
         for (uint32_t j = 0; j < blockCount.height; j++) {
-          std::memcpy(
+          copyImageData(
             dstData + j * bytesPerRow,
             srcData + j * pitchPerRow,
-            bytesPerRow);
+            bytesPerRow, nonTemporal);
         }
         
         srcData += pitchPerLayer;
         dstData += bytesPerLayer;
       }
     }
+
+    finishImageData(nonTemporal);
   }
   
   
@@ -65,10 +135,15 @@ namespace dxvk::util {
           VkExtent3D        imageExtent,
           uint32_t          imageLayers,
     const DxvkFormatInfo*   formatInfo,
-          VkImageAspectFlags aspectMask) {
+          VkImageAspectFlags aspectMask,
+          bool              nonTemporal) {
     auto dstData = reinterpret_cast<      char*>(dstBytes);
     auto srcData = reinterpret_cast<const char*>(srcBytes);
 
+    // Rough estimate is good enough here, planar formats are rare
+    nonTemporal &= imageLayers * formatInfo->elementSize * flattenImageExtent(
+      computeBlockCount(imageExtent, formatInfo->blockSize)) >= NonTemporalCopyThreshold;
+
     for (uint32_t k = 0; k < imageLayers; k++) {
       for (auto aspects = aspectMask; aspects; ) {
         auto aspect = vk::getNextAspect(aspects);
@@ -95,7 +170,7 @@ namespace dxvk::util {
                              && ((bytesPerSlice == srcSlicePitch && bytesPerSlice == dstSlicePitch) || (blockCount.depth  == 1));
 
         if (directCopy) {
-          std::memcpy(dstData, srcData, bytesTotal);
+          copyImageData(dstData, srcData, bytesTotal, nonTemporal);
 
           switch (imageType) {
             case VK_IMAGE_TYPE_1D:
@@ -115,10 +190,10 @@ namespace dxvk::util {
         } else {
           for (uint32_t i = 0; i < blockCount.depth; i++) {
             for (uint32_t j = 0; j < blockCount.height; j++) {
-              std::memcpy(
+              copyImageData(
                 dstData + j * dstRowPitch,
                 srcData + j * srcRowPitch,
-                bytesPerRow);
+                bytesPerRow, nonTemporal);
             }
 
             switch (imageType) {
@@ -140,6 +215,8 @@ namespace dxvk::util {
         }
       }
     }
+
+    finishImageData(nonTemporal);
   }
 
 
@@ -45,6 +45,8 @@ namespace dxvk::util {
    * \param [in] blockSize Number of bytes per block
    * \param [in] pitchPerRow Number of bytes between rows
    * \param [in] pitchPerLayer Number of bytes between layers
+   * \param [in] nonTemporal Use streaming stores for large copies.
+   *    Only set this for uploads into memory that is not read back.
    */
   void packImageData(
           void*             dstBytes,
@@ -52,7 +54,8 @@ namespace dxvk::util {
           VkExtent3D        blockCount,
           VkDeviceSize      blockSize,
           VkDeviceSize      pitchPerRow,
-          VkDeviceSize      pitchPerLayer);
+          VkDeviceSize      pitchPerLayer,
+          bool              nonTemporal = false);
   
   /**
    * \brief Repacks image data to a buffer
@@ -71,6 +74,8 @@ namespace dxvk::util {
    * \param [in] imageLayers Image layer count
    * \param [in] formatInfo Image format info
    * \param [in] aspectMask Image aspects to pack
+   * \param [in] nonTemporal Use streaming stores for large copies.
+   *    Only set this for uploads into memory that is not read back.
    */
   void packImageData(
           void*             dstBytes,
@@ -83,7 +88,8 @@ namespace dxvk::util {
           VkExtent3D        imageExtent,
           uint32_t          imageLayers,
     const DxvkFormatInfo*   formatInfo,
-          VkImageAspectFlags aspectMask);
+          VkImageAspectFlags aspectMask,
+          bool              nonTemporal = false);
   
   /**
    * \brief Computes minimum extent
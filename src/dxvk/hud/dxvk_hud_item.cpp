@@ -390,6 +390,10 @@ namespace dxvk::hud {
       m_cpCount = diffCounters.getCtr(DxvkStatCounter::CmdDispatchCalls);
       m_rpCount = diffCounters.getCtr(DxvkStatCounter::CmdRenderPassCount);
       m_pbCount = diffCounters.getCtr(DxvkStatCounter::CmdBarrierCount);
+      m_sbCount = diffCounters.getCtr(DxvkStatCounter::CmdSplitBarrierCount);
+      m_htCount = diffCounters.getCtr(DxvkStatCounter::CmdHoistedTransferCount);
+      m_fcCount = diffCounters.getCtr(DxvkStatCounter::CmdConversionCount);
+      m_fbCount = diffCounters.getCtr(DxvkStatCounter::CmdConversionBatchCount);
 
       m_lastUpdate = time;
     }
@@ -444,6 +448,45 @@ namespace dxvk::hud {
       { position.x + 192.0f, position.y },
       { 1.0f, 1.0f, 1.0f, 1.0f },
       str::format(m_pbCount));
+
+    if (m_sbCount) {
+      position.y += 20.0f;
+      renderer.drawText(16.0f,
+        { position.x, position.y },
+        { 0.25f, 0.5f, 1.0f, 1.0f },
+        "Split barriers:");
+
+      renderer.drawText(16.0f,
+        { position.x + 192.0f, position.y },
+        { 1.0f, 1.0f, 1.0f, 1.0f },
+        str::format(m_sbCount));
+    }
+
+    if (m_htCount) {
+      position.y += 20.0f;
+      renderer.drawText(16.0f,
+        { position.x, position.y },
+        { 0.25f, 0.5f, 1.0f, 1.0f },
+        "Hoisted copies:");
+
+      renderer.drawText(16.0f,
+        { position.x + 192.0f, position.y },
+        { 1.0f, 1.0f, 1.0f, 1.0f },
+        str::format(m_htCount));
+    }
+
+    if (m_fcCount) {
+      position.y += 20.0f;
+      renderer.drawText(16.0f,
+        { position.x, position.y },
+        { 0.25f, 0.5f, 1.0f, 1.0f },
+        "Conversions:");
+
+      renderer.drawText(16.0f,
+        { position.x + 192.0f, position.y },
+        { 1.0f, 1.0f, 1.0f, 1.0f },
+        str::format(m_fcCount, " (", m_fbCount, " batches)"));
+    }
     
     position.y += 8.0f;
     return position;
@@ -529,6 +572,25 @@ namespace dxvk::hud {
 
     m_descriptorPoolCount = counters.getCtr(DxvkStatCounter::DescriptorPoolCount);
     m_descriptorSetCount  = counters.getCtr(DxvkStatCounter::DescriptorSetCount);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(time - m_lastUpdate);
+
+    if (elapsed.count() >= UpdateInterval) {
+      uint64_t currSetLookups = counters.getCtr(DxvkStatCounter::DescriptorSetLookups);
+      uint64_t currSetReuses  = counters.getCtr(DxvkStatCounter::DescriptorSetReuses);
+
+      uint64_t lookups = currSetLookups - m_prevSetLookups;
+      uint64_t reuses  = currSetReuses - m_prevSetReuses;
+
+      m_reuseString = lookups
+        ? str::format((100 * reuses) / lookups, "%")
+        : std::string("n/a");
+
+      m_prevSetLookups = currSetLookups;
+      m_prevSetReuses  = currSetReuses;
+
+      m_lastUpdate = time;
+    }
   }
 
 
@@ -557,6 +619,17 @@ namespace dxvk::hud {
       { 1.0f, 1.0f, 1.0f, 1.0f },
       str::format(m_descriptorSetCount));
 
+    position.y += 20.0f;
+    renderer.drawText(16.0f,
+      { position.x, position.y },
+      { 1.0f, 0.25f, 0.5f, 1.0f },
+      "Set reuse:");
+
+    renderer.drawText(16.0f,
+      { position.x + 216.0f, position.y },
+      { 1.0f, 1.0f, 1.0f, 1.0f },
+      m_reuseString);
+
     position.y += 8.0f;
     return position;
   }
@@ -576,6 +649,9 @@ namespace dxvk::hud {
   void HudMemoryStatsItem::update(dxvk::high_resolution_clock::time_point time) {
     for (uint32_t i = 0; i < m_memory.memoryHeapCount; i++)
       m_heaps[i] = m_device->getMemoryStats(i);
+
+    DxvkStatCounters counters = m_device->getStatCounters();
+    m_renameMemory = counters.getCtr(DxvkStatCounter::BufferRenameMemory);
   }
 
 
@@ -606,6 +682,23 @@ namespace dxvk::hud {
       position.y += 4.0f;
     }
 
+    // Memory used by additional slices of renamed buffers
+    // is already included in the heap statistics above
+    uint64_t renameMemoryKib = m_renameMemory >> 10;
+
+    position.y += 16.0f;
+    renderer.drawText(16.0f,
+      { position.x, position.y },
+      { 1.0f, 1.0f, 0.25f, 1.0f },
+      "Buffer renaming:");
+
+    renderer.drawText(16.0f,
+      { position.x + 168.0f, position.y },
+      { 1.0f, 1.0f, 1.0f, 1.0f },
+      str::format(std::setfill(' '), std::setw(5), renameMemoryKib >> 10, ".",
+        std::setfill('0'), std::setw(1), ((renameMemoryKib & 0x3ff) * 10) >> 10, " MB"));
+    position.y += 4.0f;
+
     position.y += 4.0f;
     return position;
   }
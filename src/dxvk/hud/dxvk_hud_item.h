@@ -302,6 +302,10 @@ namespace dxvk::hud {
     uint64_t          m_cpCount = 0;
     uint64_t          m_rpCount = 0;
     uint64_t          m_pbCount = 0;
+    uint64_t          m_sbCount = 0;
+    uint64_t          m_htCount = 0;
+    uint64_t          m_fcCount = 0;
+    uint64_t          m_fbCount = 0;
 
     dxvk::high_resolution_clock::time_point m_lastUpdate
       = dxvk::high_resolution_clock::now();
@@ -341,7 +345,7 @@ namespace dxvk::hud {
    * \brief HUD item to display descriptor stats
    */
   class HudDescriptorStatsItem : public HudItem {
-
+    constexpr static int64_t UpdateInterval = 500'000;
   public:
 
     HudDescriptorStatsItem(const Rc<DxvkDevice>& device);
@@ -361,6 +365,14 @@ namespace dxvk::hud {
     uint64_t m_descriptorPoolCount = 0;
     uint64_t m_descriptorSetCount  = 0;
 
+    uint64_t m_prevSetLookups = 0;
+    uint64_t m_prevSetReuses  = 0;
+
+    std::string m_reuseString;
+
+    dxvk::high_resolution_clock::time_point m_lastUpdate
+      = dxvk::high_resolution_clock::now();
+
   };
 
 
@@ -386,6 +398,7 @@ namespace dxvk::hud {
     Rc<DxvkDevice>                    m_device;
     VkPhysicalDeviceMemoryProperties  m_memory;
     DxvkMemoryStats                   m_heaps[VK_MAX_MEMORY_HEAPS];
+    uint64_t                          m_renameMemory = 0;
 
   };
 
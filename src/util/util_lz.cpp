@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <cstring>
+
+#include "util_lz.h"
+
+namespace dxvk::lz {
+
+  constexpr uint32_t HashBits     = 12;
+  constexpr size_t   MinMatch     = 4;
+  constexpr size_t   MaxOffset    = 65535;
+
+  // The last match must start at least this many bytes
+  // before the end of the input, and the last five
+  // bytes of input are always encoded as literals.
+  constexpr size_t   MatchLimit   = 12;
+  constexpr size_t   LastLiterals = 5;
+
+  static inline uint32_t read32(const uint8_t* ptr) {
+    uint32_t result;
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+  }
+
+
+  static inline uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - HashBits);
+  }
+
+
+  static inline uint8_t* writeLength(uint8_t* dst, uint8_t* dstEnd, size_t length) {
+    while (length >= 255) {
+      if (dst == dstEnd)
+        return nullptr;
+
+      *(dst++) = 255;
+      length -= 255;
+    }
+
+    if (dst == dstEnd)
+      return nullptr;
+
+    *(dst++) = uint8_t(length);
+    return dst;
+  }
+
+
+  static inline uint8_t* writeSequence(
+          uint8_t*        dst,
+          uint8_t*        dstEnd,
+    const uint8_t*        literals,
+          size_t          literalCount,
+          size_t          offset,
+          size_t          matchLength) {
+    if (dst == dstEnd)
+      return nullptr;
+
+    uint8_t* token = dst++;
+    *token = uint8_t(std::min<size_t>(literalCount, 15) << 4);
+
+    if (literalCount >= 15 && !(dst = writeLength(dst, dstEnd, literalCount - 15)))
+      return nullptr;
+
+    if (size_t(dstEnd - dst) < literalCount)
+      return nullptr;
+
+    std::memcpy(dst, literals, literalCount);
+    dst += literalCount;
+
+    // The final sequence consists of literals only
+    if (!matchLength)
+      return dst;
+
+    if (size_t(dstEnd - dst) < 2)
+      return nullptr;
+
+    *(dst++) = uint8_t(offset);
+    *(dst++) = uint8_t(offset >> 8);
+
+    size_t matchCode = matchLength - MinMatch;
+    *token |= uint8_t(std::min<size_t>(matchCode, 15));
+
+    if (matchCode >= 15 && !(dst = writeLength(dst, dstEnd, matchCode - 15)))
+      return nullptr;
+
+    return dst;
+  }
+
+
+  size_t compress(
+    const void*             src,
+          size_t            srcSize,
+          void*             dst,
+          size_t            dstCapacity) {
+    auto srcBase = reinterpret_cast<const uint8_t*>(src);
+    auto dstBase = reinterpret_cast<uint8_t*>(dst);
+    auto dstEnd  = dstBase + dstCapacity;
+
+    uint8_t* dstPtr = dstBase;
+
+    size_t anchor = 0;
+    size_t pos    = 0;
+
+    if (srcSize > MatchLimit) {
+      uint32_t table[1u << HashBits];
+
+      for (uint32_t i = 0; i < (1u << HashBits); i++)
+        table[i] = ~0u;
+
+      size_t matchEnd = srcSize - LastLiterals;
+      size_t scanEnd  = srcSize - MatchLimit;
+
+      uint32_t misses = 0;
+
+      while (pos <= scanEnd) {
+        uint32_t value = read32(srcBase + pos);
+        uint32_t hash  = hash32(value);
+        uint32_t ref   = table[hash];
+        table[hash] = uint32_t(pos);
+
+        if (ref == ~0u || pos - ref > MaxOffset || read32(srcBase + ref) != value) {
+          // Skip ahead faster in data that does not compress well
+          pos += 1 + (misses++ >> 6);
+          continue;
+        }
+
+        misses = 0;
+
+        // Extend the match backwards into pending literals
+        while (pos > anchor && ref > 0 && srcBase[pos - 1] == srcBase[ref - 1]) {
+          pos -= 1;
+          ref -= 1;
+        }
+
+        size_t length = MinMatch;
+
+        while (pos + length < matchEnd && srcBase[pos + length] == srcBase[ref + length])
+          length += 1;
+
+        dstPtr = writeSequence(dstPtr, dstEnd, srcBase + anchor,
+          pos - anchor, pos - ref, length);
+
+        if (!dstPtr)
+          return 0;
+
+        pos   += length;
+        anchor = pos;
+
+        // Make the position right before the next
+        // search position available for matching
+        if (pos - 2 <= scanEnd)
+          table[hash32(read32(srcBase + pos - 2))] = uint32_t(pos - 2);
+      }
+    }
+
+    dstPtr = writeSequence(dstPtr, dstEnd, srcBase + anchor,
+      srcSize - anchor, 0, 0);
+
+    return dstPtr ? size_t(dstPtr - dstBase) : 0;
+  }
+
+
+  bool decompress(
+    const void*             src,
+          size_t            srcSize,
+          void*             dst,
+          size_t            dstSize) {
+    auto srcPtr = reinterpret_cast<const uint8_t*>(src);
+    auto srcEnd = srcPtr + srcSize;
+
+    auto dstBase = reinterpret_cast<uint8_t*>(dst);
+    auto dstPtr  = dstBase;
+    auto dstEnd  = dstBase + dstSize;
+
+    while (srcPtr < srcEnd) {
+      uint8_t token = *(srcPtr++);
+
+      size_t literalCount = token >> 4;
+
+      if (literalCount == 15) {
+        uint8_t next;
+
+        do {
+          if (srcPtr == srcEnd)
+            return false;
+
+          next = *(srcPtr++);
+          literalCount += next;
+        } while (next == 255);
+      }
+
+      if (size_t(srcEnd - srcPtr) < literalCount
+       || size_t(dstEnd - dstPtr) < literalCount)
+        return false;
+
+      std::memcpy(dstPtr, srcPtr, literalCount);
+      srcPtr += literalCount;
+      dstPtr += literalCount;
+
+      // The last sequence has no match
+      if (srcPtr == srcEnd)
+        break;
+
+      if (srcEnd - srcPtr < 2)
+        return false;
+
+      size_t offset = size_t(srcPtr[0]) | (size_t(srcPtr[1]) << 8);
+      srcPtr += 2;
+
+      if (!offset || offset > size_t(dstPtr - dstBase))
+        return false;
+
+      size_t matchLength = token & 0xf;
+
+      if (matchLength == 15) {
+        uint8_t next;
+
+        do {
+          if (srcPtr == srcEnd)
+            return false;
+
+          next = *(srcPtr++);
+          matchLength += next;
+        } while (next == 255);
+      }
+
+      matchLength += MinMatch;
+
+      if (size_t(dstEnd - dstPtr) < matchLength)
+        return false;
+
+      // Matches may overlap the output, copy byte by
+      // byte in that case to replicate the pattern
+      const uint8_t* matchPtr = dstPtr - offset;
+
+      if (offset >= matchLength) {
+        std::memcpy(dstPtr, matchPtr, matchLength);
+        dstPtr += matchLength;
+      } else {
+        for (size_t i = 0; i < matchLength; i++)
+          *(dstPtr++) = *(matchPtr++);
+      }
+    }
+
+    return dstPtr == dstEnd;
+  }
+
+}
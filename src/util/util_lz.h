@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dxvk::lz {
+
+  /**
+   * \brief Computes worst-case compressed size
+   *
+   * Incompressible data grows slightly when compressed,
+   * so destination buffers should be at least this big.
+   * \param [in] size Uncompressed data size
+   * \returns Maximum size of the compressed data
+   */
+  inline size_t compressBound(size_t size) {
+    return size + size / 255 + 16;
+  }
+
+  /**
+   * \brief Compresses a block of data
+   *
+   * Uses a fast LZ77-style codec that produces LZ4-compatible
+   * blocks. Favours speed over compression ratio, which makes
+   * it suitable for compressing large amounts of texture data.
+   * \param [in] src Uncompressed data
+   * \param [in] srcSize Uncompressed data size
+   * \param [out] dst Destination buffer
+   * \param [in] dstCapacity Size of the destination buffer
+   * \returns Compressed size, or 0 if the data did not fit
+   */
+  size_t compress(
+    const void*             src,
+          size_t            srcSize,
+          void*             dst,
+          size_t            dstCapacity);
+
+  /**
+   * \brief Decompresses a block of data
+   *
+   * \param [in] src Compressed data
+   * \param [in] srcSize Compressed data size
+   * \param [out] dst Destination buffer
+   * \param [in] dstSize Expected uncompressed size
+   * \returns \c true if the data was decompressed successfully
+   *    and the decompressed size matches \c dstSize exactly
+   */
+  bool decompress(
+    const void*             src,
+          size_t            srcSize,
+          void*             dst,
+          size_t            dstSize);
+
+}